@@ -22,7 +22,8 @@ struct Fiber::FiberImpl {
     std::mutex guard;
     std::function<void()> entry_point;
     std::function<void()> rewind_point;
-    std::shared_ptr<Fiber> previous_fiber;
+    // Fiber that switched to this one, only valid until the switch has completed
+    Fiber* previous_fiber{};
     bool is_thread_fiber{};
     bool released{};
 
@@ -40,7 +41,7 @@ void Fiber::Start(boost::context::detail::transfer_t& transfer) {
     ASSERT(impl->previous_fiber != nullptr);
     impl->previous_fiber->impl->context = transfer.fctx;
     impl->previous_fiber->impl->guard.unlock();
-    impl->previous_fiber.reset();
+    impl->previous_fiber = nullptr;
     impl->entry_point();
     UNREACHABLE();
 }
@@ -107,22 +108,23 @@ void Fiber::Rewind() {
     boost::context::detail::jump_fcontext(impl->rewind_context, this);
 }
 
-void Fiber::YieldTo(std::weak_ptr<Fiber> weak_from, Fiber& to) {
+void Fiber::YieldTo(const std::shared_ptr<Fiber>& from, Fiber& to) {
     to.impl->guard.lock();
-    to.impl->previous_fiber = weak_from.lock();
+    to.impl->previous_fiber = from.get();
 
     auto transfer = boost::context::detail::jump_fcontext(to.impl->context, &to);
 
-    // "from" might no longer be valid if the thread was killed
-    if (auto from = weak_from.lock()) {
-        if (from->impl->previous_fiber == nullptr) {
-            ASSERT_MSG(false, "previous_fiber is nullptr!");
-            return;
-        }
-        from->impl->previous_fiber->impl->context = transfer.fctx;
-        from->impl->previous_fiber->impl->guard.unlock();
-        from->impl->previous_fiber.reset();
+    // The fiber resuming us passes the fiber that is running now, "from" is not touched as it
+    // might have been released while it was switched out
+    auto* const current = static_cast<Fiber*>(transfer.data);
+    Fiber* const previous = current->impl->previous_fiber;
+    if (previous == nullptr) {
+        ASSERT_MSG(false, "previous_fiber is nullptr!");
+        return;
     }
+    previous->impl->context = transfer.fctx;
+    previous->impl->guard.unlock();
+    current->impl->previous_fiber = nullptr;
 }
 
 std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
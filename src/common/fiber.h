@@ -39,8 +39,9 @@ public:
     Fiber& operator=(Fiber&&) = default;
 
     /// Yields control from Fiber 'from' to Fiber 'to'
-    /// Fiber 'from' must be the currently running fiber.
-    static void YieldTo(std::weak_ptr<Fiber> weak_from, Fiber& to);
+    /// Fiber 'from' must be the currently running fiber. It is not accessed after it has been
+    /// switched out, so it may be released while it is not running.
+    static void YieldTo(const std::shared_ptr<Fiber>& from, Fiber& to);
     [[nodiscard]] static std::shared_ptr<Fiber> ThreadToFiber();
 
     void SetRewindPoint(std::function<void()>&& rewind_func);
@@ -14,6 +14,8 @@
 #ifndef _GNU_SOURCE
 #define _GNU_SOURCE
 #endif
+#include <fstream>
+#include <string>
 #include <boost/icl/interval_set.hpp>
 #include <fcntl.h>
 #include <sys/mman.h>
@@ -199,6 +201,11 @@ public:
         UNREACHABLE();
     }
 
+    bool EnableHugePages() {
+        // Large pages can't be used with placeholder mappings
+        return false;
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
@@ -475,9 +482,6 @@ public:
             LOG_CRITICAL(HW_Memory, "mmap failed: {}", strerror(errno));
             throw std::bad_alloc{};
         }
-#if defined(__linux__)
-        madvise(virtual_base, virtual_size, MADV_HUGEPAGE);
-#endif
 
         free_manager.SetAddressSpace(virtual_base, virtual_size);
         good = true;
@@ -511,6 +515,10 @@ public:
         void* ret = mmap(virtual_base + virtual_offset, length, flags, MAP_SHARED | MAP_FIXED, fd,
                          host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+
+        if (use_huge_pages) {
+            AdviseHugePages(static_cast<u8*>(ret), host_offset, length);
+        }
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -566,6 +574,29 @@ public:
         virtual_base = nullptr;
     }
 
+    bool EnableHugePages() {
+#ifdef __linux__
+        // The backing memory is shmem, which only uses huge pages on advised mappings when
+        // shmem_enabled is set to advise, within_size or always
+        std::ifstream shmem_enabled("/sys/kernel/mm/transparent_hugepage/shmem_enabled");
+        std::string mode;
+        std::getline(shmem_enabled, mode);
+        if (mode.empty() || mode.find("[never]") != std::string::npos ||
+            mode.find("[deny]") != std::string::npos) {
+            LOG_WARNING(HW_Memory, "Transparent huge pages are disabled for shared memory");
+            return false;
+        }
+        if (madvise(backing_base, backing_size, MADV_HUGEPAGE) != 0) {
+            LOG_WARNING(HW_Memory, "madvise failed: {}", strerror(errno));
+            return false;
+        }
+        use_huge_pages = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
@@ -592,6 +623,21 @@ private:
         }
     }
 
+    void AdviseHugePages([[maybe_unused]] u8* pointer, [[maybe_unused]] size_t host_offset,
+                         [[maybe_unused]] size_t length) {
+#ifdef __linux__
+        // A huge page can only be mapped where the view and the backing offset share the same
+        // alignment within it, and the view covers a whole huge page
+        const uintptr_t address = reinterpret_cast<uintptr_t>(pointer);
+        if ((address - host_offset) % HugePageSize != 0 ||
+            AlignUp(address, HugePageSize) + HugePageSize > address + length) {
+            return;
+        }
+        int ret = madvise(pointer, length, MADV_HUGEPAGE);
+        ASSERT_MSG(ret == 0, "madvise failed: {}", strerror(errno));
+#endif
+    }
+
     void AdjustMap(size_t* virtual_offset, size_t* length) {
         if (virtual_base != nullptr) {
             return;
@@ -615,6 +661,7 @@ private:
 
     int fd{-1}; // memfd file descriptor, -1 is the error value of memfd_create
     FreeRegionManager free_manager{};
+    bool use_huge_pages{};
 };
 
 #else // ^^^ Linux ^^^ vvv Generic vvv
@@ -639,13 +686,17 @@ public:
 
     void EnableDirectMappedAddress() {}
 
+    bool EnableHugePages() {
+        return false;
+    }
+
     u8* backing_base{nullptr};
     u8* virtual_base{nullptr};
 };
 
 #endif // ^^^ Generic ^^^
 
-HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_, bool use_huge_pages)
     : backing_size(backing_size_), virtual_size(virtual_size_) {
     try {
         // Try to allocate a fastmem arena.
@@ -663,6 +714,10 @@ HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
             virtual_base_offset = virtual_base - impl->virtual_base;
         }
 
+        if (use_huge_pages && impl->EnableHugePages()) {
+            LOG_INFO(HW_Memory, "Using transparent huge pages for emulated memory");
+        }
+
     } catch (const std::bad_alloc&) {
         LOG_CRITICAL(HW_Memory,
                      "Fastmem unavailable, falling back to VirtualBuffer for memory allocation");
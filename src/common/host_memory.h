@@ -24,7 +24,11 @@ DECLARE_ENUM_FLAG_OPERATORS(MemoryPermission)
  */
 class HostMemory {
 public:
-    explicit HostMemory(size_t backing_size_, size_t virtual_size_);
+    /**
+     * @param use_huge_pages Back the memory with transparent huge pages where the host supports
+     *                       them, views use huge pages when their alignment allows it.
+     */
+    explicit HostMemory(size_t backing_size_, size_t virtual_size_, bool use_huge_pages = false);
     ~HostMemory();
 
     /**
@@ -29,6 +29,7 @@ public:
                                                                           other.page_bits, 0)},
           first_level_shift{std::exchange(other.first_level_shift, 0)},
           first_level_chunk_size{std::exchange(other.first_level_chunk_size, 0)},
+          alloc_size{std::exchange(other.alloc_size, 0)},
           first_level_map{std::move(other.first_level_map)}, base_ptr{std::exchange(other.base_ptr,
                                                                                     nullptr)} {}
 
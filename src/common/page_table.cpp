@@ -1,11 +1,65 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
+#include "common/multi_level_page_table.inc"
 #include "common/page_table.h"
-#include "common/scope_exit.h"
 
 namespace Common {
 
+template class MultiLevelPageTable<PageBackingTable::Entry>;
+
+PageBackingTable::PageBackingTable() = default;
+
+PageBackingTable::~PageBackingTable() noexcept = default;
+
+void PageBackingTable::Resize(std::size_t address_space_width_in_bits,
+                              std::size_t page_size_in_bits) {
+    num_pages = 1ULL << (address_space_width_in_bits - page_size_in_bits);
+    block_shift = BlockBits - page_size_in_bits;
+    regions.resize(num_pages >> block_shift);
+    tables = MultiLevelPageTable<Entry>(address_space_width_in_bits,
+                                        address_space_width_in_bits - BlockBits, page_size_in_bits);
+}
+
+void PageBackingTable::Map(u64 page, u64 num_pages_to_map, const Entry& entry) {
+    const u64 region_pages = 1ULL << block_shift;
+    const u64 end = page + num_pages_to_map;
+    while (page != end) {
+        const u64 region_index = page >> block_shift;
+        const u64 region_end = std::min((region_index + 1) << block_shift, end);
+        Region& region = regions[region_index];
+
+        if (page % region_pages == 0 && region_end - page == region_pages) {
+            region.entry = entry;
+            region.is_table = false;
+        } else if (region.is_table || region.entry != entry) {
+            if (!region.is_table) {
+                // Split the block, the table is filled before it is used for lookups
+                tables.ReserveRange(region_index << BlockBits, 1);
+                std::fill_n(tables.data() + (region_index << block_shift), region_pages,
+                            region.entry);
+                region.is_table = true;
+            }
+            std::fill(tables.data() + page, tables.data() + region_end, entry);
+        }
+        page = region_end;
+    }
+}
+
+bool PageBackingTable::HasBackingAddr(u64 page, u64 num_pages_to_check, u64 backing_addr) const {
+    const Region& region = regions[page >> block_shift];
+    if (!region.is_table) {
+        return region.entry.backing_addr == backing_addr;
+    }
+    const Entry* const begin = tables.data() + page;
+    const Entry* const end = begin + num_pages_to_check;
+    return std::find_if(begin, end, [backing_addr](const Entry& entry) {
+               return entry.backing_addr != backing_addr;
+           }) == end;
+}
+
 PageTable::PageTable() = default;
 
 PageTable::~PageTable() noexcept = default;
@@ -14,6 +68,7 @@ bool PageTable::BeginTraversal(TraversalEntry* out_entry, TraversalContext* out_
                                Common::ProcessAddress address) const {
     out_context->next_offset = GetInteger(address);
     out_context->next_page = address / page_size;
+    out_context->max_block_pages = MinTraversalBlockPages;
 
     return this->ContinueTraversal(out_entry, out_context);
 }
@@ -23,26 +78,49 @@ bool PageTable::ContinueTraversal(TraversalEntry* out_entry, TraversalContext* c
     out_entry->phys_addr = 0;
     out_entry->block_size = page_size;
 
-    // Regardless of whether the page was mapped, advance on exit.
-    SCOPE_EXIT {
-        context->next_page += 1;
-        context->next_offset += page_size;
-    };
-
     // Validate that we can read the actual entry.
     const auto page = context->next_page;
-    if (page >= backing_addr.size()) {
+    if (page >= backing.size()) {
+        context->next_page += 1;
+        context->next_offset += page_size;
         return false;
     }
 
     // Validate that the entry is mapped.
-    const auto phys_addr = backing_addr[page];
+    const auto phys_addr = backing.GetBackingAddr(page);
     if (phys_addr == 0) {
+        context->next_page += 1;
+        context->next_offset += page_size;
         return false;
     }
 
+    // Like a hardware page table with block mappings, report an aligned block of contiguous
+    // pages starting at the entry, so traversals of large ranges take few steps.
+    u64 block_pages = 1;
+    while (block_pages < context->max_block_pages) {
+        const u64 next_pages = block_pages * 2;
+        if (page % next_pages != 0 || page + next_pages > backing.size() ||
+            (phys_addr + page * page_size) % (next_pages * page_size) != 0) {
+            break;
+        }
+        // Only the half following the current block has to be checked, blocks never cross a
+        // region of the backing table as MaxTraversalBlockPages covers one region
+        if (!backing.HasBackingAddr(page + block_pages, block_pages, phys_addr)) {
+            break;
+        }
+        block_pages = next_pages;
+    }
+
     // Populate the results.
     out_entry->phys_addr = phys_addr + context->next_offset;
+    out_entry->block_size = block_pages * page_size;
+
+    // Advance to the next block, allowing a larger one if this one was not cut short.
+    context->next_page = page + block_pages;
+    context->next_offset = context->next_page * page_size;
+    if (block_pages == context->max_block_pages) {
+        context->max_block_pages = std::min(block_pages * 2, MaxTraversalBlockPages);
+    }
 
     return true;
 }
@@ -51,8 +129,7 @@ void PageTable::Resize(std::size_t address_space_width_in_bits, std::size_t page
     const std::size_t num_page_table_entries{1ULL
                                              << (address_space_width_in_bits - page_size_in_bits)};
     pointers.resize(num_page_table_entries);
-    backing_addr.resize(num_page_table_entries);
-    blocks.resize(num_page_table_entries);
+    backing.Resize(address_space_width_in_bits, page_size_in_bits);
     current_address_space_width_in_bits = address_space_width_in_bits;
     page_size = 1ULL << page_size_in_bits;
 }
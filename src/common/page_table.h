@@ -6,6 +6,7 @@
 #include <atomic>
 
 #include "common/common_types.h"
+#include "common/multi_level_page_table.h"
 #include "common/typed_address.h"
 #include "common/virtual_buffer.h"
 
@@ -24,6 +25,74 @@ enum class PageType : u8 {
     RasterizerCachedMemory,
 };
 
+/**
+ * Physical backing of the pages of an address space.
+ *
+ * Like a hardware page table with block mappings, a 2 MiB region that belongs to a single
+ * contiguous mapping is described by one block entry. Only regions shared by several mappings get
+ * a table of per page entries, which is committed on first use.
+ */
+class PageBackingTable {
+public:
+    struct Entry {
+        /// Physical address of the page minus its virtual address, zero when unmapped
+        u64 backing_addr{};
+        /// Virtual address of the mapping the page belongs to
+        u64 block{};
+
+        bool operator==(const Entry&) const = default;
+    };
+
+    /// Size of the region covered by a block entry, in bits.
+    static constexpr std::size_t BlockBits = 21;
+
+    PageBackingTable();
+    ~PageBackingTable() noexcept;
+
+    PageBackingTable(const PageBackingTable&) = delete;
+    PageBackingTable& operator=(const PageBackingTable&) = delete;
+
+    PageBackingTable(PageBackingTable&&) noexcept = default;
+    PageBackingTable& operator=(PageBackingTable&&) noexcept = default;
+
+    void Resize(std::size_t address_space_width_in_bits, std::size_t page_size_in_bits);
+
+    /// Sets the entry of num_pages pages starting at page, fully covered regions become blocks.
+    void Map(u64 page, u64 num_pages, const Entry& entry);
+
+    /// Returns true when all pages of a range inside one region have the given backing address.
+    [[nodiscard]] bool HasBackingAddr(u64 page, u64 num_pages, u64 backing_addr) const;
+
+    [[nodiscard]] const Entry& Get(u64 page) const {
+        const Region& region = regions[page >> block_shift];
+        return region.is_table ? tables[page] : region.entry;
+    }
+
+    [[nodiscard]] u64 GetBackingAddr(u64 page) const {
+        return Get(page).backing_addr;
+    }
+
+    [[nodiscard]] u64 GetBlock(u64 page) const {
+        return Get(page).block;
+    }
+
+    /// Returns the number of pages covered by the table
+    [[nodiscard]] std::size_t size() const {
+        return num_pages;
+    }
+
+private:
+    struct Region {
+        Entry entry{};
+        bool is_table{};
+    };
+
+    VirtualBuffer<Region> regions;
+    MultiLevelPageTable<Entry> tables;
+    std::size_t block_shift{};
+    std::size_t num_pages{};
+};
+
 /**
  * A (reasonably) fast way of allowing switchable and remappable process address spaces. It loosely
  * mimics the way a real CPU page table works.
@@ -37,8 +106,15 @@ struct PageTable {
     struct TraversalContext {
         u64 next_page{};
         u64 next_offset{};
+        u64 max_block_pages{};
     };
 
+    /// Size limit of the first block reported by a traversal, in pages. The limit doubles with
+    /// every full block, so short traversals do not scan far past their end.
+    static constexpr u64 MinTraversalBlockPages = 1;
+    /// Largest block reported by a traversal, in pages.
+    static constexpr u64 MaxTraversalBlockPages = 512;
+
     /// Number of bits reserved for attribute tagging.
     /// This can be at most the guaranteed alignment of the pointers in the page table.
     static constexpr int ATTRIBUTE_BITS = 2;
@@ -124,18 +200,18 @@ struct PageTable {
             return false;
         }
 
-        *out_phys_addr = backing_addr[virt_addr / page_size] + GetInteger(virt_addr);
+        *out_phys_addr = backing.GetBackingAddr(virt_addr / page_size) + GetInteger(virt_addr);
         return true;
     }
 
     /**
      * Vector of memory pointers backing each page. An entry can only be non-null if the
-     * corresponding attribute element is of type `Memory`.
+     * corresponding attribute element is of type `Memory`. This stays a flat array, as the CPU
+     * backends index it directly.
      */
     VirtualBuffer<PageInfo> pointers;
-    VirtualBuffer<u64> blocks;
 
-    VirtualBuffer<u64> backing_addr;
+    PageBackingTable backing;
 
     std::size_t current_address_space_width_in_bits{};
 
@@ -177,6 +177,22 @@ bool IsNceEnabled() {
     return is_nce_enabled;
 }
 
+bool IsMultiCoreEnabled() {
+    return values.use_multi_core.GetValue() && !values.deterministic_replay;
+}
+
+bool IsAsyncGpuEnabled() {
+    return values.use_asynchronous_gpu_emulation.GetValue() && !values.deterministic_replay;
+}
+
+bool IsSpeedLimitEnabled() {
+    return values.use_speed_limit.GetValue() && !values.deterministic_replay;
+}
+
+bool IsRngSeedEnabled() {
+    return values.rng_seed_enabled.GetValue() || values.deterministic_replay;
+}
+
 bool IsDockedMode() {
     return values.use_docked_mode.GetValue() == Settings::ConsoleMode::Docked;
 }
@@ -250,6 +250,7 @@ struct Values {
                                               Category::CpuDebug};
     Setting<bool> cpuopt_ignore_memory_aborts{linkage, true, "cpuopt_ignore_memory_aborts",
                                               Category::CpuDebug};
+    Setting<bool> cpuopt_shared_jit{linkage, true, "cpuopt_shared_jit", Category::CpuDebug};
 
     SwitchableSetting<bool> cpuopt_unsafe_unfuse_fma{linkage, true, "cpuopt_unsafe_unfuse_fma",
                                                      Category::CpuUnsafe};
@@ -397,6 +398,23 @@ struct Values {
                                                false,
 #endif
                                                "async_presentation", Category::RendererAdvanced};
+    SwitchableSetting<bool> use_low_latency_presentation{linkage,
+                                                         false,
+                                                         "use_low_latency_presentation",
+                                                         Category::RendererAdvanced,
+                                                         Specialization::Paired,
+                                                         true,
+                                                         true};
+    SwitchableSetting<u16, true> present_latency_target{linkage,
+                                                        33,
+                                                        4,
+                                                        200,
+                                                        "present_latency_target",
+                                                        Category::RendererAdvanced,
+                                                        Specialization::Countable,
+                                                        true,
+                                                        true,
+                                                        &use_low_latency_presentation};
     SwitchableSetting<bool> renderer_force_max_clock{linkage, false, "force_max_clock",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_reactive_flushing{linkage,
@@ -584,6 +602,24 @@ struct Values {
     Setting<bool> dump_macros{
         linkage, false, "dump_macros", Category::DebuggingGraphics, Specialization::Default, false};
     Setting<bool> enable_fs_access_log{linkage, false, "enable_fs_access_log", Category::Debugging};
+    Setting<bool> enable_guest_profiler{linkage, false, "enable_guest_profiler",
+                                        Category::Debugging};
+    Setting<bool> enable_ipc_statistics{linkage, false, "enable_ipc_statistics",
+                                        Category::Debugging};
+    Setting<bool> enable_svc_statistics{linkage, false, "enable_svc_statistics",
+                                        Category::Debugging};
+    // Makes benchmark runs repeatable, see IsMultiCoreEnabled. Inputs come from the TAS scripts
+    // and the emulator exits when they finish. Virtual time stops while HLE services answer
+    // requests, but an answer can still interrupt a running guest thread at a host dependent
+    // point. std::random_device users such as UUID::MakeRandom are not seeded yet, and the
+    // replay report only has per-thread CPU times on Linux. Compare the runs of a replay with
+    // tools/compare-replays.sh.
+    Setting<bool> deterministic_replay{linkage, false, "deterministic_replay",
+                                       Category::Debugging};
+    Setting<std::string> pooled_services{linkage, std::string(), "pooled_services",
+                                         Category::Debugging};
+    Setting<bool> use_host_huge_pages{linkage, false, "use_host_huge_pages",
+                                      Category::Debugging};
     Setting<bool> reporting_services{
         linkage, false, "reporting_services", Category::Debugging, Specialization::Default, false};
     Setting<bool> quest_flag{linkage, false, "quest_flag", Category::Debugging};
@@ -630,6 +666,13 @@ bool IsFastmemEnabled();
 void SetNceEnabled(bool is_64bit);
 bool IsNceEnabled();
 
+// Deterministic replays run on one host thread in virtual time, without speed limit and with a
+// fixed RNG seed.
+bool IsMultiCoreEnabled();
+bool IsAsyncGpuEnabled();
+bool IsSpeedLimitEnabled();
+bool IsRngSeedEnabled();
+
 bool IsDockedMode();
 
 float Volume();
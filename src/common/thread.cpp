@@ -4,6 +4,12 @@
 
 #include <string>
 
+#ifdef __linux__
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#endif
+
 #include "common/error.h"
 #include "common/logging/log.h"
 #include "common/thread.h"
@@ -120,4 +126,48 @@ void SetCurrentThreadName(const char* name) {
 
 #endif
 
+#ifdef __linux__
+
+std::vector<ThreadCpuTime> GetThreadCpuTimes() {
+    const auto ticks_per_second = static_cast<u64>(sysconf(_SC_CLK_TCK));
+    std::vector<ThreadCpuTime> result;
+    std::error_code ec;
+    for (const auto& task : std::filesystem::directory_iterator("/proc/self/task", ec)) {
+        std::ifstream comm_file(task.path() / "comm");
+        std::ifstream stat_file(task.path() / "stat");
+        std::string name;
+        std::string stat;
+        if (!std::getline(comm_file, name) || !std::getline(stat_file, stat)) {
+            // The thread exited while we were looking at it
+            continue;
+        }
+
+        // The name in the stat line may contain spaces, the fields after it are separated by
+        // spaces, starting with the state. utime and stime are the 12th and 13th of those.
+        std::istringstream fields(stat.substr(stat.rfind(')') + 2));
+        std::string field;
+        for (int i = 0; i < 11; ++i) {
+            fields >> field;
+        }
+        u64 user_ticks = 0;
+        u64 system_ticks = 0;
+        fields >> user_ticks >> system_ticks;
+
+        const u64 ticks = user_ticks + system_ticks;
+        result.push_back({
+            .name = std::move(name),
+            .cpu_time = std::chrono::nanoseconds{ticks * 1'000'000'000 / ticks_per_second},
+        });
+    }
+    return result;
+}
+
+#else
+
+std::vector<ThreadCpuTime> GetThreadCpuTimes() {
+    return {};
+}
+
+#endif
+
 } // namespace Common
@@ -9,7 +9,9 @@
 #include <condition_variable>
 #include <cstddef>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 
@@ -106,4 +108,13 @@ void SetCurrentThreadPriority(ThreadPriority new_priority);
 
 void SetCurrentThreadName(const char* name);
 
+struct ThreadCpuTime {
+    std::string name;
+    std::chrono::nanoseconds cpu_time;
+};
+
+/// Returns the CPU time used by each running thread of this process, or nothing when the host
+/// does not expose it.
+std::vector<ThreadCpuTime> GetThreadCpuTimes();
+
 } // namespace Common
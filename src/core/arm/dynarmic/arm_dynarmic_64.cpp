@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+
 #include "common/settings.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_64.h"
@@ -16,11 +18,20 @@ using namespace Common::Literals;
 class DynarmicCallbacks64 : public Dynarmic::A64::UserCallbacks {
 public:
     explicit DynarmicCallbacks64(ArmDynarmic64& parent, Kernel::KProcess* process)
-        : m_parent{parent}, m_memory(process->GetMemory()),
+        : m_parent{&parent}, m_memory(process->GetMemory()),
           m_process(process), m_debugger_enabled{parent.m_system.DebuggerEnabled()},
           m_check_memory_access{m_debugger_enabled ||
                                 !Settings::values.cpuopt_ignore_memory_aborts.GetValue()} {}
 
+    ~DynarmicCallbacks64() {
+        LOG_INFO(Core_ARM,
+                 "JIT of core {} ({} cores): translated {} instructions, decoding took at least "
+                 "{} ms, {} MiB of code cache reserved",
+                 m_first_core_index, m_num_cores, m_translated_instructions,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(m_translation_time).count(),
+                 m_code_cache_size / 1_MiB);
+    }
+
     u8 MemoryRead8(u64 vaddr) override {
         CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Read);
         return m_memory.Read8(vaddr);
@@ -45,7 +56,9 @@ public:
         if (!m_memory.IsValidVirtualAddressRange(vaddr, sizeof(u32))) {
             return std::nullopt;
         }
-        return m_memory.Read32(vaddr);
+        const u32 instruction = m_memory.Read32(vaddr);
+        RecordTranslation(vaddr, instruction);
+        return instruction;
     }
 
     void MemoryWrite8(u64 vaddr, u8 value) override {
@@ -97,7 +110,7 @@ public:
     }
 
     void InterpreterFallback(u64 pc, std::size_t num_instructions) override {
-        m_parent.LogBacktrace(m_process);
+        m_parent->LogBacktrace(m_process);
         LOG_ERROR(Core_ARM,
                   "Unimplemented instruction @ 0x{:X} for {} instructions (instr = {:08X})", pc,
                   num_instructions, m_memory.Read32(pc));
@@ -111,11 +124,11 @@ public:
             static constexpr u64 ICACHE_LINE_SIZE = 64;
 
             const u64 cache_line_start = value & ~(ICACHE_LINE_SIZE - 1);
-            m_parent.InvalidateCacheRange(cache_line_start, ICACHE_LINE_SIZE);
+            m_parent->InvalidateCacheRange(cache_line_start, ICACHE_LINE_SIZE);
             break;
         }
         case Dynarmic::A64::InstructionCacheOperation::InvalidateAllToPoU:
-            m_parent.ClearInstructionCache();
+            m_parent->ClearInstructionCache();
             break;
         case Dynarmic::A64::InstructionCacheOperation::InvalidateAllToPoUInnerSharable:
         default:
@@ -123,7 +136,7 @@ public:
             break;
         }
 
-        m_parent.m_jit->HaltExecution(Dynarmic::HaltReason::CacheInvalidation);
+        m_parent->m_jit->HaltExecution(Dynarmic::HaltReason::CacheInvalidation);
     }
 
     void ExceptionRaised(u64 pc, Dynarmic::A64::Exception exception) override {
@@ -144,19 +157,19 @@ public:
                 return;
             }
 
-            m_parent.LogBacktrace(m_process);
+            m_parent->LogBacktrace(m_process);
             LOG_CRITICAL(Core_ARM, "ExceptionRaised(exception = {}, pc = {:08X}, code = {:08X})",
                          static_cast<std::size_t>(exception), pc, m_memory.Read32(pc));
         }
     }
 
     void CallSVC(u32 svc) override {
-        m_parent.m_svc = svc;
-        m_parent.m_jit->HaltExecution(SupervisorCall);
+        m_parent->m_svc = svc;
+        m_parent->m_jit->HaltExecution(SupervisorCall);
     }
 
     void AddTicks(u64 ticks) override {
-        ASSERT_MSG(!m_parent.m_uses_wall_clock, "Dynarmic ticking disabled");
+        ASSERT_MSG(!m_parent->m_uses_wall_clock, "Dynarmic ticking disabled");
 
         // Divide the number of ticks by the amount of CPU cores. TODO(Subv): This yields only a
         // rough approximation of the amount of executed ticks in the system, it may be thrown off
@@ -167,17 +180,17 @@ public:
         // Always execute at least one tick.
         amortized_ticks = std::max<u64>(amortized_ticks, 1);
 
-        m_parent.m_system.CoreTiming().AddTicks(amortized_ticks);
+        m_parent->m_system.CoreTiming().AddTicks(amortized_ticks);
     }
 
     u64 GetTicksRemaining() override {
-        ASSERT_MSG(!m_parent.m_uses_wall_clock, "Dynarmic ticking disabled");
+        ASSERT_MSG(!m_parent->m_uses_wall_clock, "Dynarmic ticking disabled");
 
-        return std::max<s64>(m_parent.m_system.CoreTiming().GetDowncount(), 0);
+        return std::max<s64>(m_parent->m_system.CoreTiming().GetDowncount(), 0);
     }
 
     u64 GetCNTPCT() override {
-        return m_parent.m_system.CoreTiming().GetClockTicks();
+        return m_parent->m_system.CoreTiming().GetClockTicks();
     }
 
     bool CheckMemoryAccess(u64 addr, u64 size, Kernel::DebugWatchpointType type) {
@@ -188,7 +201,7 @@ public:
         if (!m_memory.IsValidVirtualAddressRange(addr, size)) {
             LOG_CRITICAL(Core_ARM, "Stopping execution due to unmapped memory access at {:#x}",
                          addr);
-            m_parent.m_jit->HaltExecution(PrefetchAbort);
+            m_parent->m_jit->HaltExecution(PrefetchAbort);
             return false;
         }
 
@@ -196,23 +209,39 @@ public:
             return true;
         }
 
-        const auto match{m_parent.MatchingWatchpoint(addr, size, type)};
+        const auto match{m_parent->MatchingWatchpoint(addr, size, type)};
         if (match) {
-            m_parent.m_halted_watchpoint = match;
-            m_parent.m_jit->HaltExecution(DataAbort);
+            m_parent->m_halted_watchpoint = match;
+            m_parent->m_jit->HaltExecution(DataAbort);
             return false;
         }
 
         return true;
     }
 
+    // Dynarmic reads the instructions of a block in order while decoding it, and the block ends
+    // at its first branch, exception generating or system instruction at the latest. The time
+    // between two reads of the same block is spent decoding, a lower bound of the translation
+    // time, which dynarmic does not report.
+    void RecordTranslation(u64 vaddr, u32 instruction) {
+        const auto now = std::chrono::steady_clock::now();
+        if (vaddr == m_last_code_read + 4 && !m_last_code_read_ends_block) {
+            m_translation_time += now - m_last_code_read_time;
+        }
+        ++m_translated_instructions;
+        m_last_code_read = vaddr;
+        m_last_code_read_time = now;
+        m_last_code_read_ends_block = ((instruction >> 26) & 0b111) == 0b101;
+    }
+
     void ReturnException(u64 pc, Dynarmic::HaltReason hr) {
-        m_parent.GetContext(m_parent.m_breakpoint_context);
-        m_parent.m_breakpoint_context.pc = pc;
-        m_parent.m_jit->HaltExecution(hr);
+        m_parent->GetContext(m_parent->m_breakpoint_context);
+        m_parent->m_breakpoint_context.pc = pc;
+        m_parent->m_jit->HaltExecution(hr);
     }
 
-    ArmDynarmic64& m_parent;
+    // Core currently running on the JIT, it changes when the JIT is shared between cores
+    ArmDynarmic64* m_parent;
     Core::Memory::Memory& m_memory;
     u64 m_tpidrro_el0{};
     u64 m_tpidr_el0{};
@@ -220,6 +249,16 @@ public:
     const bool m_debugger_enabled{};
     const bool m_check_memory_access{};
     static constexpr u64 MinimumRunCycles = 10000U;
+
+    // Translation statistics, logged when the JIT is destroyed
+    std::size_t m_first_core_index{};
+    std::size_t m_num_cores{1};
+    std::size_t m_code_cache_size{};
+    u64 m_translated_instructions{};
+    std::chrono::steady_clock::duration m_translation_time{};
+    u64 m_last_code_read{};
+    std::chrono::steady_clock::time_point m_last_code_read_time{};
+    bool m_last_code_read_ends_block{true};
 };
 
 std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* page_table,
@@ -282,6 +321,7 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
         // Don't waste too much memory on null_jit
         config.code_cache_size = 8_MiB;
     }
+    m_cb->m_code_cache_size = config.code_cache_size;
 
     // Safe optimizations
     if (Settings::values.cpu_debug_mode) {
@@ -364,6 +404,7 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
 HaltReason ArmDynarmic64::RunThread(Kernel::KThread* thread) {
     ScopedJitExecution sj(thread->GetOwnerProcess());
 
+    m_cb->m_parent = this;
     m_jit->ClearExclusiveState();
     return TranslateHaltReason(m_jit->Run());
 }
@@ -371,6 +412,7 @@ HaltReason ArmDynarmic64::RunThread(Kernel::KThread* thread) {
 HaltReason ArmDynarmic64::StepThread(Kernel::KThread* thread) {
     ScopedJitExecution sj(thread->GetOwnerProcess());
 
+    m_cb->m_parent = this;
     m_jit->ClearExclusiveState();
     return TranslateHaltReason(m_jit->Step());
 }
@@ -404,9 +446,21 @@ void ArmDynarmic64::RewindBreakpointInstruction() {
 }
 
 ArmDynarmic64::ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProcess* process,
-                             DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index)
+                             DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index,
+                             ArmDynarmic64* shared_jit_core)
     : ArmInterface{uses_wall_clock}, m_system{system}, m_exclusive_monitor{exclusive_monitor},
-      m_cb(std::make_unique<DynarmicCallbacks64>(*this, process)), m_core_index{core_index} {
+      m_core_index{core_index} {
+    if (shared_jit_core) {
+        // Reuse the translated code of a core that never runs at the same time as this one.
+        // Contexts are saved and loaded on every core switch, so only the callbacks have to
+        // follow the core that runs.
+        m_cb = shared_jit_core->m_cb;
+        m_jit = shared_jit_core->m_jit;
+        ++m_cb->m_num_cores;
+        return;
+    }
+    m_cb = std::make_shared<DynarmicCallbacks64>(*this, process);
+    m_cb->m_first_core_index = core_index;
     auto& page_table = process->GetPageTable().GetBasePageTable();
     auto& page_table_impl = page_table.GetImpl();
     m_jit = MakeJit(&page_table_impl, page_table.GetAddressSpaceWidth());
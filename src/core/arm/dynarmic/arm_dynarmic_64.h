@@ -25,8 +25,11 @@ class System;
 
 class ArmDynarmic64 final : public ArmInterface {
 public:
+    /// When shared_jit_core is not null, this core executes code translated by the JIT of
+    /// shared_jit_core. Both cores must never run guest code at the same time.
     ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProcess* process,
-                  DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index);
+                  DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index,
+                  ArmDynarmic64* shared_jit_core = nullptr);
     ~ArmDynarmic64() override;
 
     Architecture GetArchitecture() const override {
@@ -61,7 +64,7 @@ private:
 
     std::shared_ptr<Dynarmic::A64::Jit> MakeJit(Common::PageTable* page_table,
                                                 std::size_t address_space_bits) const;
-    std::unique_ptr<DynarmicCallbacks64> m_cb{};
+    std::shared_ptr<DynarmicCallbacks64> m_cb{};
     std::size_t m_core_index{};
 
     std::shared_ptr<Dynarmic::A64::Jit> m_jit{};
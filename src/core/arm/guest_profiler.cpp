@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <fstream>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "common/demangle.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "core/arm/debug.h"
+#include "core/arm/guest_profiler.h"
+#include "core/arm/symbols.h"
+#include "core/core.h"
+#include "core/core_timing.h"
+#include "core/hardware_properties.h"
+#include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/physical_core.h"
+#include "core/memory.h"
+
+namespace Core {
+
+GuestProfiler::GuestProfiler(System& system_) : system{system_} {
+    sample_event = Core::Timing::CreateEvent(
+        "GuestProfilerSample",
+        [this](s64 time, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+            for (size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; ++core) {
+                system.Kernel().PhysicalCore(core).RequestSample();
+            }
+            return std::nullopt;
+        });
+}
+
+GuestProfiler::~GuestProfiler() = default;
+
+void GuestProfiler::Start(Kernel::KProcess* process, std::chrono::nanoseconds interval) {
+    {
+        std::scoped_lock lk{mutex};
+        stack_counts.clear();
+        num_samples = 0;
+        sampled_process = process;
+    }
+    is_running.store(true, std::memory_order_relaxed);
+    system.CoreTiming().ScheduleLoopingEvent(interval, interval, sample_event);
+
+    LOG_INFO(Core_ARM, "Guest profiler started, sampling every {} us",
+             std::chrono::duration_cast<std::chrono::microseconds>(interval).count());
+}
+
+void GuestProfiler::Stop() {
+    if (!is_running.exchange(false, std::memory_order_relaxed)) {
+        return;
+    }
+    system.CoreTiming().UnscheduleEvent(sample_event);
+}
+
+void GuestProfiler::AddSample(Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx) {
+    if (!IsRunning() || process != sampled_process) {
+        return;
+    }
+
+    // Walk the frame records, see GetAArch64Backtrace and GetAArch32Backtrace.
+    auto& memory = process->GetMemory();
+    const bool is_64 = process->Is64Bit();
+    const u64 record_size = is_64 ? 16 : 8;
+
+    std::vector<u64> stack;
+    stack.reserve(MaxFrames);
+    stack.push_back(ctx.pc);
+    u64 lr = ctx.lr;
+    u64 fp = ctx.fp;
+    while (stack.size() < MaxFrames) {
+        stack.push_back(lr);
+        if (!fp || (fp % 4 != 0) || !memory.IsValidVirtualAddressRange(fp, record_size)) {
+            break;
+        }
+        if (is_64) {
+            lr = memory.Read64(fp + 8);
+            fp = memory.Read64(fp);
+        } else {
+            lr = memory.Read32(fp + 4);
+            fp = memory.Read32(fp);
+        }
+    }
+
+    std::scoped_lock lk{mutex};
+    ++stack_counts[std::move(stack)];
+    ++num_samples;
+}
+
+void GuestProfiler::WriteFoldedStacks(const std::filesystem::path& path) {
+    std::scoped_lock lk{mutex};
+    if (sampled_process == nullptr || stack_counts.empty()) {
+        return;
+    }
+
+    const auto modules = FindModules(sampled_process);
+    const bool is_64 = sampled_process->Is64Bit();
+    std::map<VAddr, Symbols::Symbols> symbols;
+    for (const auto& [base, name] : modules) {
+        symbols.emplace(base, Symbols::GetSymbols(base, sampled_process->GetMemory(), is_64));
+    }
+
+    std::map<u64, std::string> frame_names;
+    const auto symbolize = [&](u64 address) -> const std::string& {
+        const auto [it, is_new] = frame_names.try_emplace(address);
+        if (!is_new) {
+            return it->second;
+        }
+        const auto module = modules.upper_bound(address);
+        if (module == modules.begin()) {
+            it->second = fmt::format("unknown+{:#x}", address);
+            return it->second;
+        }
+        const auto& [base, module_name] = *std::prev(module);
+        const u64 offset = address - base;
+        const auto symbol = Symbols::GetSymbolName(symbols.at(base), offset);
+        it->second = symbol ? fmt::format("{}!{}", module_name, Common::DemangleSymbol(*symbol))
+                            : fmt::format("{}+{:#x}", module_name, offset);
+        return it->second;
+    };
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        LOG_ERROR(Core_ARM, "Failed to open guest profile {}", Common::FS::PathToUTF8String(path));
+        return;
+    }
+    for (const auto& [stack, count] : stack_counts) {
+        // Folded stacks are written from the outermost caller to the sampled function
+        std::string line;
+        for (auto frame = stack.rbegin(); frame != stack.rend(); ++frame) {
+            if (!line.empty()) {
+                line += ';';
+            }
+            line += symbolize(*frame);
+        }
+        file << line << ' ' << count << '\n';
+    }
+
+    LOG_INFO(Core_ARM, "Wrote {} guest profiler samples to {}", num_samples,
+             Common::FS::PathToUTF8String(path));
+}
+
+} // namespace Core
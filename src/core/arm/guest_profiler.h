@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Kernel {
+class KProcess;
+namespace Svc {
+struct ThreadContext;
+}
+} // namespace Kernel
+
+namespace Core::Timing {
+struct EventType;
+} // namespace Core::Timing
+
+namespace Core {
+
+class System;
+
+/**
+ * Statistical profiler of guest code.
+ *
+ * A CoreTiming event periodically asks every physical core to take a sample. Cores capture the
+ * PC and the frame pointer chain of the running guest thread the next time they leave the JIT,
+ * so sampling never reads the state of a core while it is executing. Samples are aggregated by
+ * call stack and symbolized against the loaded modules when they are written out.
+ */
+class GuestProfiler {
+public:
+    explicit GuestProfiler(System& system_);
+    ~GuestProfiler();
+
+    /// Starts sampling the cores of the given process
+    void Start(Kernel::KProcess* process, std::chrono::nanoseconds interval);
+
+    /// Stops sampling, captured samples are kept until the next Start
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const {
+        return is_running.load(std::memory_order_relaxed);
+    }
+
+    /// Records a sample of a core, called from the core thread that was running the process
+    void AddSample(Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx);
+
+    /// Writes the samples in the folded stack format, one "frame;frame;... count" line per stack
+    void WriteFoldedStacks(const std::filesystem::path& path);
+
+private:
+    /// Maximum number of frames captured from the frame pointer chain
+    static constexpr size_t MaxFrames = 32;
+
+    System& system;
+    std::shared_ptr<Core::Timing::EventType> sample_event;
+    std::atomic_bool is_running{};
+    Kernel::KProcess* sampled_process{};
+
+    std::mutex mutex;
+    std::map<std::vector<u64>, u64> stack_counts;
+    u64 num_samples{};
+};
+
+} // namespace Core
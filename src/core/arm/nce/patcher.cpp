@@ -1,9 +1,18 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <fstream>
+#include <optional>
+#include <thread>
+
 #include "common/arm64/native_clock.h"
 #include "common/bit_cast.h"
+#include "common/cityhash.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/literals.h"
+#include "common/logging/log.h"
 #include "core/arm/nce/arm_nce.h"
 #include "core/arm/nce/guest_context.h"
 #include "core/arm/nce/instructions.h"
@@ -22,6 +31,153 @@ using NativeExecutionParameters = Kernel::KThread::NativeExecutionParameters;
 constexpr size_t MaxRelativeBranch = 128_MiB;
 constexpr u32 ModuleCodeIndex = 0x24 / sizeof(u32);
 
+namespace {
+constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'n', 'c', 'e', 'p'};
+constexpr u32 CACHE_VERSION = 1;
+
+// Smallest part of .text scanned by a thread, splitting smaller modules is not worth it
+constexpr size_t MinScanChunkWords = 1_MiB / sizeof(u32);
+
+bool IsPatchSite(u32 inst) {
+    if (SVC{inst}.Verify()) {
+        return true;
+    }
+    if (auto mrs = MRS{inst}; mrs.Verify()) {
+        const u32 system_reg = mrs.GetSystemReg();
+        return system_reg == TpidrroEl0 || system_reg == TpidrEl0 || system_reg == CntpctEl0 ||
+               system_reg == CntfrqEl0;
+    }
+    if (auto msr = MSR{inst}; msr.Verify() && msr.GetSystemReg() == TpidrEl0) {
+        return true;
+    }
+    return Exclusive{inst}.Verify();
+}
+
+// Returns the indices of the instructions that have to be patched, in ascending order
+std::vector<u32> FindPatchSites(std::span<const u32> text_words) {
+    if (text_words.size() <= ModuleCodeIndex) {
+        return {};
+    }
+    const size_t num_words = text_words.size() - ModuleCodeIndex;
+    const size_t num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    const size_t num_chunks = std::clamp<size_t>(num_words / MinScanChunkWords, 1, num_threads);
+
+    std::vector<std::vector<u32>> chunk_sites(num_chunks);
+    const auto scan_chunk = [&](size_t chunk) {
+        const size_t begin = ModuleCodeIndex + num_words * chunk / num_chunks;
+        const size_t end = ModuleCodeIndex + num_words * (chunk + 1) / num_chunks;
+        for (size_t i = begin; i < end; i++) {
+            if (IsPatchSite(text_words[i])) {
+                chunk_sites[chunk].push_back(static_cast<u32>(i));
+            }
+        }
+    };
+    {
+        std::vector<std::jthread> threads;
+        for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+            threads.emplace_back(scan_chunk, chunk);
+        }
+        scan_chunk(0);
+    }
+
+    std::vector<u32> sites = std::move(chunk_sites[0]);
+    for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+        sites.insert(sites.end(), chunk_sites[chunk].begin(), chunk_sites[chunk].end());
+    }
+    return sites;
+}
+
+std::optional<std::vector<u32>> LoadPatchSites(const std::filesystem::path& path, u64 text_hash,
+                                               size_t num_words) try {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    file.exceptions(std::ifstream::failbit);
+
+    std::array<char, 8> magic_number;
+    u32 version;
+    u64 file_text_hash;
+    u64 num_sites;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&version), sizeof(version))
+        .read(reinterpret_cast<char*>(&file_text_hash), sizeof(file_text_hash));
+    if (magic_number != MAGIC_NUMBER || version != CACHE_VERSION || file_text_hash != text_hash) {
+        // The module was modified, e.g. by a mod with the same build id
+        LOG_INFO(Core_ARM, "Discarding outdated NCE patch cache");
+        return std::nullopt;
+    }
+    file.read(reinterpret_cast<char*>(&num_sites), sizeof(num_sites));
+    if (num_sites > num_words) {
+        LOG_ERROR(Core_ARM, "Invalid NCE patch cache {}", Common::FS::PathToUTF8String(path));
+        return std::nullopt;
+    }
+
+    std::vector<u32> sites(num_sites);
+    file.read(reinterpret_cast<char*>(sites.data()), sites.size() * sizeof(u32));
+    if (std::ranges::any_of(sites, [num_words](u32 site) { return site >= num_words; })) {
+        LOG_ERROR(Core_ARM, "Invalid NCE patch cache {}", Common::FS::PathToUTF8String(path));
+        return std::nullopt;
+    }
+    return sites;
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    return std::nullopt;
+}
+
+void SavePatchSites(const std::filesystem::path& path, u64 text_hash,
+                    std::span<const u32> sites) try {
+    if (!Common::FS::CreateParentDirs(path)) {
+        return;
+    }
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open NCE patch cache {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    file.exceptions(std::ofstream::failbit);
+    const u64 num_sites = sites.size();
+    file.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
+        .write(reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(CACHE_VERSION))
+        .write(reinterpret_cast<const char*>(&text_hash), sizeof(text_hash))
+        .write(reinterpret_cast<const char*>(&num_sites), sizeof(num_sites))
+        .write(reinterpret_cast<const char*>(sites.data()), sites.size() * sizeof(u32));
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    if (!Common::FS::RemoveFile(path)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete NCE patch cache {}",
+                  Common::FS::PathToUTF8String(path));
+    }
+}
+
+std::span<const u32> GetTextWords(const Kernel::PhysicalMemory& program_image,
+                                  const Kernel::CodeSet::Segment& code) {
+    const auto text = std::span{program_image}.subspan(code.offset, code.size);
+    return std::span<const u32>{reinterpret_cast<const u32*>(text.data()),
+                                text.size() / sizeof(u32)};
+}
+} // Anonymous namespace
+
+std::vector<u32> GetPatchSites(const Kernel::PhysicalMemory& program_image,
+                               const Kernel::CodeSet::Segment& code,
+                               const std::filesystem::path& cache_path) {
+    const auto text_words = GetTextWords(program_image, code);
+    if (cache_path.empty()) {
+        return FindPatchSites(text_words);
+    }
+    const u64 text_hash = Common::CityHash64(reinterpret_cast<const char*>(text_words.data()),
+                                             text_words.size_bytes());
+    if (auto sites = LoadPatchSites(cache_path, text_hash, text_words.size())) {
+        return std::move(*sites);
+    }
+    std::vector<u32> sites = FindPatchSites(text_words);
+    SavePatchSites(cache_path, text_hash, sites);
+    return sites;
+}
+
 Patcher::Patcher() : c(m_patch_instructions) {
     // The first word of the patch section is always a branch to the first instruction of the
     // module.
@@ -39,7 +195,7 @@ Patcher::Patcher() : c(m_patch_instructions) {
 Patcher::~Patcher() = default;
 
 bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
-                        const Kernel::CodeSet::Segment& code) {
+                        const Kernel::CodeSet::Segment& code, std::span<const u32> sites) {
     // If we have patched modules but cannot reach the new module, then it needs its own patcher.
     const size_t image_size = program_image.size();
     if (total_program_size + image_size > MaxRelativeBranch && total_program_size > 0) {
@@ -55,12 +211,10 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
     curr_patch->m_branch_to_module_relocations.push_back({0, 0});
 
     // Retrieve text segment data.
-    const auto text = std::span{program_image}.subspan(code.offset, code.size);
-    const auto text_words =
-        std::span<const u32>{reinterpret_cast<const u32*>(text.data()), text.size() / sizeof(u32)};
+    const auto text_words = GetTextWords(program_image, code);
 
     // Loop through instructions, patching as needed.
-    for (u32 i = ModuleCodeIndex; i < static_cast<u32>(text_words.size()); i++) {
+    for (const u32 i : sites) {
         const u32 inst = text_words[i];
 
         const auto AddRelocations = [&] {
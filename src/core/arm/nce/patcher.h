@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <span>
 #include <unordered_map>
 #include <vector>
@@ -26,13 +27,20 @@ using ModuleTextAddress = u64;
 using PatchTextAddress = u64;
 using EntryTrampolines = std::unordered_map<ModuleTextAddress, PatchTextAddress>;
 
+/// Returns the indices of the .text instructions that need patching. They are cached in
+/// cache_path if it is not empty.
+std::vector<u32> GetPatchSites(const Kernel::PhysicalMemory& program_image,
+                               const Kernel::CodeSet::Segment& code,
+                               const std::filesystem::path& cache_path = {});
+
 class Patcher {
 public:
     explicit Patcher();
     ~Patcher();
 
+    /// Generates the patch of a module from the sites returned by GetPatchSites
     bool PatchText(const Kernel::PhysicalMemory& program_image,
-                   const Kernel::CodeSet::Segment& code);
+                   const Kernel::CodeSet::Segment& code, std::span<const u32> sites);
     bool RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::CodeSet::Segment& code,
                          Kernel::PhysicalMemory& program_image, EntryTrampolines* out_trampolines);
     size_t GetSectionSize() const noexcept;
@@ -9,12 +9,14 @@
 
 #include "audio_core/audio_core.h"
 #include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "common/settings_enums.h"
 #include "common/string_util.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/arm/guest_profiler.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -35,6 +37,7 @@
 #include "core/hle/kernel/k_scheduler.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
+#include "core/hle/kernel/svc_statistics.h"
 #include "core/hle/service/acc/profile_manager.h"
 #include "core/hle/service/am/applet_manager.h"
 #include "core/hle/service/am/frontend/applets.h"
@@ -42,6 +45,7 @@
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/hle/service/glue/glue_manager.h"
 #include "core/hle/service/glue/time/static.h"
+#include "core/hle/service/ipc_statistics.h"
 #include "core/hle/service/psc/time/static.h"
 #include "core/hle/service/psc/time/steady_clock.h"
 #include "core/hle/service/psc/time/system_clock.h"
@@ -55,6 +59,7 @@
 #include "core/memory.h"
 #include "core/memory/cheat_engine.h"
 #include "core/perf_stats.h"
+#include "core/replay_statistics.h"
 #include "core/reporter.h"
 #include "core/telemetry_session.h"
 #include "core/tools/freezer.h"
@@ -74,6 +79,9 @@ namespace Core {
 
 namespace {
 
+// Time of the emulated RTC when a deterministic replay starts, 2024-01-01 00:00:00 UTC
+constexpr s64 ReplayRtcTime = 1'704'067'200;
+
 FileSys::StorageId GetStorageIdForFrontendSlot(
     std::optional<FileSys::ContentProviderUnionSlot> slot) {
     if (!slot.has_value()) {
@@ -138,12 +146,13 @@ FileSys::VirtualFile GetGameFileFromPath(const FileSys::VirtualFilesystem& vfs,
 struct System::Impl {
     explicit Impl(System& system)
         : kernel{system}, fs_controller{system}, hid_core{}, room_network{}, cpu_manager{system},
-          reporter{system}, applet_manager{system}, frontend_applets{system}, profile_manager{} {}
+          reporter{system}, applet_manager{system}, frontend_applets{system}, profile_manager{},
+          guest_profiler{system} {}
 
     void Initialize(System& system) {
         device_memory = std::make_unique<Core::DeviceMemory>();
 
-        is_multicore = Settings::values.use_multi_core.GetValue();
+        is_multicore = Settings::IsMultiCoreEnabled();
         extended_memory_layout =
             Settings::values.memory_layout_mode.GetValue() != Settings::MemoryLayout::Memory_4Gb;
 
@@ -161,7 +170,7 @@ struct System::Impl {
         // Create default implementations of applets if one is not provided.
         frontend_applets.SetDefaultAppletsIfMissing();
 
-        is_async_gpu = Settings::values.use_asynchronous_gpu_emulation.GetValue();
+        is_async_gpu = Settings::IsAsyncGpuEnabled();
 
         kernel.SetMulticore(is_multicore);
         cpu_manager.SetMulticore(is_multicore);
@@ -170,7 +179,7 @@ struct System::Impl {
 
     void ReinitializeIfNecessary(System& system) {
         const bool must_reinitialize =
-            is_multicore != Settings::values.use_multi_core.GetValue() ||
+            is_multicore != Settings::IsMultiCoreEnabled() ||
             extended_memory_layout != (Settings::values.memory_layout_mode.GetValue() !=
                                        Settings::MemoryLayout::Memory_4Gb);
 
@@ -180,7 +189,7 @@ struct System::Impl {
 
         LOG_DEBUG(Kernel, "Re-initializing");
 
-        is_multicore = Settings::values.use_multi_core.GetValue();
+        is_multicore = Settings::IsMultiCoreEnabled();
         extended_memory_layout =
             Settings::values.memory_layout_mode.GetValue() != Settings::MemoryLayout::Memory_4Gb;
 
@@ -224,9 +233,7 @@ struct System::Impl {
             time_offset = Settings::values.custom_rtc_offset.GetValue();
         }
 
-        const auto posix_time = std::chrono::system_clock::now().time_since_epoch();
-        const u64 current_time =
-            +std::chrono::duration_cast<std::chrono::seconds>(posix_time).count();
+        const auto current_time = static_cast<u64>(system.GetRtcTime());
         const u64 new_time = current_time + time_offset;
 
         Service::PSC::Time::SystemClockContext context{};
@@ -410,6 +417,22 @@ struct System::Impl {
         GetAndResetPerfStats();
         perf_stats->BeginSystemFrame();
 
+        statistics_program_id = params.program_id;
+        if (Settings::values.enable_guest_profiler) {
+            guest_profiler.Start(kernel.ApplicationProcess(), GuestProfilerInterval);
+        }
+        if (Settings::values.enable_ipc_statistics) {
+            ipc_statistics.Start();
+        }
+        if (Settings::values.enable_svc_statistics) {
+            kernel.GetSvcStatistics().Start();
+        }
+        if (Settings::values.deterministic_replay) {
+            LOG_INFO(Core, "Running a deterministic replay with RNG seed {:08X}",
+                     Settings::values.rng_seed.GetValue());
+            replay_statistics.Start(core_timing.GetGlobalTimeNs());
+        }
+
         std::string title_version;
         const FileSys::PatchManager pm(params.program_id, system.GetFileSystemController(),
                                        system.GetContentProvider());
@@ -429,6 +452,30 @@ struct System::Impl {
         return status;
     }
 
+    /// Stops the debug statistics started at load and writes their reports into the log directory
+    void StopStatistics() {
+        const auto log_dir = Common::FS::GetYuzuPath(Common::FS::YuzuPath::LogDir);
+        const auto report_path = [&](std::string_view name) {
+            return log_dir / fmt::format("{:016X}_{}", statistics_program_id, name);
+        };
+        if (guest_profiler.IsRunning()) {
+            guest_profiler.Stop();
+            guest_profiler.WriteFoldedStacks(report_path("guest_profile.folded"));
+        }
+        if (ipc_statistics.IsRunning()) {
+            ipc_statistics.Stop();
+            ipc_statistics.WriteReport(report_path("ipc_statistics.txt"));
+        }
+        if (auto& svc_statistics = kernel.GetSvcStatistics(); svc_statistics.IsRunning()) {
+            svc_statistics.Stop();
+            svc_statistics.WriteReport(report_path("svc_statistics.txt"));
+        }
+        if (replay_statistics.IsRunning()) {
+            replay_statistics.Stop(core_timing.GetGlobalTimeNs(), perf_stats->GetTotalGameFrames());
+            replay_statistics.WriteReport(report_path("replay.txt"));
+        }
+    }
+
     void ShutdownMainProcess() {
         SetShuttingDown(true);
 
@@ -445,6 +492,14 @@ struct System::Impl {
                                         perf_results.frametime * 1000.0);
             telemetry_session->AddField(performance, "Mean_Frametime_MS",
                                         perf_stats->GetMeanFrametime());
+            telemetry_session->AddField(performance, "Shutdown_UnparkedTime",
+                                        perf_results.unparked_time * 100.0);
+            telemetry_session->AddField(performance, "Shutdown_WakeLatency_US",
+                                        perf_results.wake_latency * 1'000'000.0);
+            LOG_INFO(Core,
+                     "Emulated cores were unparked {:.2f} seconds per emulated second, parked "
+                     "cores resumed {:.1f} us after an interrupt",
+                     perf_results.unparked_time, perf_results.wake_latency * 1'000'000.0);
         }
 
         is_powered_on = false;
@@ -459,6 +514,7 @@ struct System::Impl {
         core_timing.SyncPause(false);
         Network::CancelPendingSocketOperations();
         kernel.SuspendEmulation(true);
+        StopStatistics();
         kernel.CloseServices();
         kernel.ShutdownCores();
         applet_manager.Reset();
@@ -534,7 +590,17 @@ struct System::Impl {
     }
 
     PerfStatsResults GetAndResetPerfStats() {
-        return perf_stats->GetAndResetStats(core_timing.GetGlobalTimeUs());
+        CpuIdleStats cpu_idle{
+            // The single core thread advances virtual time when idle instead of parking
+            .num_threads = is_multicore ? static_cast<u32>(Core::Hardware::NUM_CPU_CORES) : 0U,
+        };
+        for (size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; ++core) {
+            const auto idle = kernel.PhysicalCore(core).GetAndResetIdleStatistics();
+            cpu_idle.parked_time += idle.parked_time;
+            cpu_idle.num_wakeups += idle.num_wakeups;
+            cpu_idle.wake_latency += idle.wake_latency;
+        }
+        return perf_stats->GetAndResetStats(core_timing.GetGlobalTimeUs(), cpu_idle);
     }
 
     mutable std::mutex suspend_guard;
@@ -597,6 +663,16 @@ struct System::Impl {
     /// Debugger
     std::unique_ptr<Core::Debugger> debugger;
 
+    /// Sampling profiler of guest code
+    static constexpr std::chrono::microseconds GuestProfilerInterval{1000};
+    Core::GuestProfiler guest_profiler;
+
+    /// Latency and throughput of HLE service requests
+    Service::IpcStatistics ipc_statistics;
+    ReplayStatistics replay_statistics;
+    /// Program the statistics are recorded for, names their reports
+    u64 statistics_program_id{};
+
     SystemResultStatus status = SystemResultStatus::Success;
     std::string status_details = "";
 
@@ -1009,6 +1085,16 @@ void System::ExitCPUProfile() {
     MicroProfileLeave(impl->microprofile_cpu[core], impl->dynarmic_ticks[core]);
 }
 
+s64 System::GetRtcTime() const {
+    if (Settings::values.deterministic_replay) {
+        const auto emulated_time = impl->core_timing.GetGlobalTimeNs();
+        return ReplayRtcTime +
+               std::chrono::duration_cast<std::chrono::seconds>(emulated_time).count();
+    }
+    const auto posix_time = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::seconds>(posix_time).count();
+}
+
 bool System::IsMulticore() const {
     return impl->is_multicore;
 }
@@ -1025,6 +1111,14 @@ const Core::Debugger& System::GetDebugger() const {
     return *impl->debugger;
 }
 
+Core::GuestProfiler& System::GetGuestProfiler() {
+    return impl->guest_profiler;
+}
+
+Service::IpcStatistics& System::GetIpcStatistics() {
+    return impl->ipc_statistics;
+}
+
 Network::RoomNetwork& System::GetRoomNetwork() {
     return impl->room_network;
 }
@@ -72,6 +72,7 @@ namespace Glue {
 class ARPManager;
 } // namespace Glue
 
+class IpcStatistics;
 class ServerManager;
 
 namespace SM {
@@ -119,6 +120,7 @@ class Debugger;
 class DeviceMemory;
 class ExclusiveMonitor;
 class GPUDirtyMemoryManager;
+class GuestProfiler;
 class PerfStats;
 class Reporter;
 class SpeedLimiter;
@@ -244,6 +246,8 @@ public:
     [[nodiscard]] const Service::Account::ProfileManager& GetProfileManager() const;
     [[nodiscard]] Core::Debugger& GetDebugger();
     [[nodiscard]] const Core::Debugger& GetDebugger() const;
+    [[nodiscard]] Core::GuestProfiler& GetGuestProfiler();
+    [[nodiscard]] Service::IpcStatistics& GetIpcStatistics();
     [[nodiscard]] Network::RoomNetwork& GetRoomNetwork();
     [[nodiscard]] const Network::RoomNetwork& GetRoomNetwork() const;
     [[nodiscard]] Tools::RenderdocAPI& GetRenderdocAPI();
@@ -257,6 +261,9 @@ public:
     void RegisterHostThread();
     void EnterCPUProfile();
     void ExitCPUProfile();
+    /// Returns the POSIX time in seconds the emulated RTC follows. Deterministic replays start
+    /// at a fixed time and advance it with the emulated time instead of the host clock.
+    [[nodiscard]] s64 GetRtcTime() const;
     [[nodiscard]] bool IsMulticore() const;
     [[nodiscard]] bool DebuggerEnabled() const;
     void RunServer(std::unique_ptr<Service::ServerManager>&& server_manager);
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <functional>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -21,6 +22,7 @@
 namespace Core::Timing {
 
 constexpr s64 MAX_SLICE_LENGTH = 10000;
+constexpr size_t MIN_COMPACT_SIZE = 256;
 
 std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callback) {
     return std::make_shared<EventType>(std::move(callback), std::move(name));
@@ -31,7 +33,7 @@ struct CoreTiming::Event {
     u64 fifo_order;
     std::weak_ptr<EventType> type;
     s64 reschedule_time;
-    heap_t::handle_type handle{};
+    size_t sequence_number;
 
     // Sort by time, unless the times are the same, in which case sort by
     // the order added to the queue
@@ -42,6 +44,11 @@ struct CoreTiming::Event {
     friend bool operator<(const Event& left, const Event& right) {
         return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
     }
+
+    [[nodiscard]] bool IsCancelled() const {
+        const auto event_type{type.lock()};
+        return !event_type || event_type->sequence_number != sequence_number;
+    }
 };
 
 CoreTiming::CoreTiming() : clock{Common::CreateOptimalClock()} {}
@@ -121,8 +128,8 @@ void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
         std::scoped_lock scope{basic_lock};
         const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
 
-        auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
-        (*h).handle = h;
+        PushEvent(Event{next_time.count(), event_fifo_id++, event_type, 0,
+                        event_type->sequence_number});
     }
 
     event.Set();
@@ -136,9 +143,8 @@ void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
         std::scoped_lock scope{basic_lock};
         const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
 
-        auto h{event_queue.emplace(
-            Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
-        (*h).handle = h;
+        PushEvent(Event{next_time.count(), event_fifo_id++, event_type, resched_time.count(),
+                        event_type->sequence_number});
     }
 
     event.Set();
@@ -149,18 +155,7 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     {
         std::scoped_lock lk{basic_lock};
 
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
-            }
-        }
-
-        for (auto& h : to_remove) {
-            event_queue.erase(h);
-        }
-
+        // Cancels every queued event of this type, they are skipped when they reach the top
         event_type->sequence_number++;
     }
 
@@ -201,61 +196,75 @@ std::optional<s64> CoreTiming::Advance() {
     std::scoped_lock lock{advance_lock, basic_lock};
     global_timer = GetGlobalTimeNs().count();
 
-    while (!event_queue.empty() && event_queue.top().time <= global_timer) {
-        const Event& evt = event_queue.top();
-
-        if (const auto event_type{evt.type.lock()}) {
-            const auto evt_time = evt.time;
-            const auto evt_sequence_num = event_type->sequence_number;
-
-            if (evt.reschedule_time == 0) {
-                event_queue.pop();
-
-                basic_lock.unlock();
-
-                event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time});
-
-                basic_lock.lock();
-            } else {
-                basic_lock.unlock();
+    while (!event_queue.empty() && event_queue.front().time <= global_timer) {
+        Event evt = PopEvent();
 
-                const auto new_schedule_time{event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
+        const auto event_type{evt.type.lock()};
+        if (!event_type || event_type->sequence_number != evt.sequence_number) {
+            continue;
+        }
 
-                basic_lock.lock();
+        basic_lock.unlock();
 
-                if (evt_sequence_num != event_type->sequence_number) {
-                    // Heap handle is invalidated after external modification.
-                    continue;
-                }
+        const auto new_schedule_time{event_type->callback(
+            evt.time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt.time})};
 
-                const auto next_schedule_time{new_schedule_time.has_value()
-                                                  ? new_schedule_time.value().count()
-                                                  : evt.reschedule_time};
+        basic_lock.lock();
 
-                // If this event was scheduled into a pause, its time now is going to be way
-                // behind. Re-set this event to continue from the end of the pause.
-                auto next_time{evt.time + next_schedule_time};
-                if (evt.time < pause_end_time) {
-                    next_time = pause_end_time + next_schedule_time;
-                }
+        // Looping events are rescheduled, unless they were unscheduled during the callback
+        if (evt.reschedule_time != 0 && evt.sequence_number == event_type->sequence_number) {
+            const auto next_schedule_time{new_schedule_time.has_value()
+                                              ? new_schedule_time.value().count()
+                                              : evt.reschedule_time};
 
-                event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
-                                                     next_schedule_time, evt.handle});
+            // If this event was scheduled into a pause, its time now is going to be way
+            // behind. Re-set this event to continue from the end of the pause.
+            auto next_time{evt.time + next_schedule_time};
+            if (evt.time < pause_end_time) {
+                next_time = pause_end_time + next_schedule_time;
             }
+
+            PushEvent(Event{next_time, event_fifo_id++, std::move(evt.type), next_schedule_time,
+                            evt.sequence_number});
         }
 
         global_timer = GetGlobalTimeNs().count();
     }
 
+    // Don't wake up for events that were cancelled
+    while (!event_queue.empty() && event_queue.front().IsCancelled()) {
+        PopEvent();
+    }
+
     if (!event_queue.empty()) {
-        return event_queue.top().time;
+        return event_queue.front().time;
     } else {
         return std::nullopt;
     }
 }
 
+void CoreTiming::PushEvent(Event&& evt) {
+    if (event_queue.size() >= event_queue_compact_size) {
+        RemoveCancelledEvents();
+    }
+    event_queue.push_back(std::move(evt));
+    std::push_heap(event_queue.begin(), event_queue.end(), std::greater<>());
+}
+
+CoreTiming::Event CoreTiming::PopEvent() {
+    std::pop_heap(event_queue.begin(), event_queue.end(), std::greater<>());
+    Event evt = std::move(event_queue.back());
+    event_queue.pop_back();
+    return evt;
+}
+
+void CoreTiming::RemoveCancelledEvents() {
+    // Compacting once the queue doubled keeps the cost of cancellation amortized constant
+    std::erase_if(event_queue, [](const Event& evt) { return evt.IsCancelled(); });
+    std::make_heap(event_queue.begin(), event_queue.end(), std::greater<>());
+    event_queue_compact_size = std::max(MIN_COMPACT_SIZE, event_queue.size() * 2);
+}
+
 void CoreTiming::ThreadLoop() {
     has_started = true;
     while (!shutting_down) {
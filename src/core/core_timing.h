@@ -11,8 +11,7 @@
 #include <optional>
 #include <string>
 #include <thread>
-
-#include <boost/heap/fibonacci_heap.hpp>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread.h"
@@ -34,7 +33,7 @@ struct EventType {
     /// A pointer to the name of the event.
     const std::string name;
     /// A monotonic sequence number, incremented when this event is
-    /// changed externally.
+    /// changed externally. Queued events with an older sequence number are cancelled.
     size_t sequence_number;
 };
 
@@ -146,6 +145,10 @@ private:
 
     void Reset();
 
+    void PushEvent(Event&& evt);
+    Event PopEvent();
+    void RemoveCancelledEvents();
+
     std::unique_ptr<Common::WallClock> clock;
 
     s64 global_timer = 0;
@@ -154,10 +157,10 @@ private:
     s64 timer_resolution_ns;
 #endif
 
-    using heap_t =
-        boost::heap::fibonacci_heap<CoreTiming::Event, boost::heap::compare<std::greater<>>>;
-
-    heap_t event_queue;
+    /// Min-heap of pending events. Unscheduling is lazy, cancelled events are dropped when they
+    /// reach the top or when the queue is compacted.
+    std::vector<Event> event_queue;
+    size_t event_queue_compact_size{};
     u64 event_fifo_id = 0;
 
     Common::Event event{};
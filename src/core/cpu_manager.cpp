@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/fiber.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -22,6 +24,7 @@ CpuManager::~CpuManager() = default;
 
 void CpuManager::Initialize() {
     num_cores = is_multicore ? Core::Hardware::NUM_CPU_CORES : 1;
+    wait_for_hle_requests = !is_multicore && Settings::values.deterministic_replay;
     gpu_barrier = std::make_unique<Common::Barrier>(num_cores + 1);
 
     for (std::size_t core = 0; core < num_cores; core++) {
@@ -121,6 +124,7 @@ void CpuManager::SingleCoreRunGuestThread() {
             physical_core = &kernel.CurrentPhysicalCore();
         }
 
+        WaitForHleRequests();
         kernel.SetIsPhantomModeForSingleCore(true);
         system.CoreTiming().Advance();
         kernel.SetIsPhantomModeForSingleCore(false);
@@ -135,6 +139,7 @@ void CpuManager::SingleCoreRunIdleThread() {
     kernel.CurrentScheduler()->OnThreadStart();
 
     while (true) {
+        WaitForHleRequests();
         PreemptSingleCore(false);
         system.CoreTiming().AddTicks(1000U);
         idle_count++;
@@ -142,6 +147,22 @@ void CpuManager::SingleCoreRunIdleThread() {
     }
 }
 
+void CpuManager::WaitForHleRequests() {
+    if (!wait_for_hle_requests) {
+        return;
+    }
+
+    // Replays stop virtual time while HLE services answer requests on their host threads, so the
+    // answers arrive after the same number of ticks on every run
+    if (!system.Kernel().WaitForHleRequests(HleRequestTimeout)) {
+        LOG_WARNING(Core,
+                    "An HLE request is pending for more than {} s, virtual time runs on and the "
+                    "replay is no longer deterministic",
+                    HleRequestTimeout.count() / 1000);
+        wait_for_hle_requests = false;
+    }
+}
+
 void CpuManager::PreemptSingleCore(bool from_running_environment) {
     auto& kernel = system.Kernel();
 
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <thread>
@@ -83,6 +84,7 @@ private:
 
     void GuestActivate();
     void HandleInterrupt();
+    void WaitForHleRequests();
     void ShutdownThread();
     void RunThread(std::stop_token stop_token, std::size_t core);
 
@@ -99,7 +101,9 @@ private:
     std::atomic<std::size_t> current_core{};
     std::size_t idle_count{};
     std::size_t num_cores{};
+    bool wait_for_hle_requests{};
     static constexpr std::size_t max_cycle_runs = 5;
+    static constexpr std::chrono::milliseconds HleRequestTimeout{10000};
 
     System& system;
 };
@@ -23,6 +23,7 @@
 #include "core/hle/kernel/k_page_table.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_thread.h"
+#include "core/hle/kernel/svc_statistics.h"
 #include "core/loader/loader.h"
 #include "core/memory.h"
 
@@ -615,7 +616,8 @@ void GDBStub::HandleRcmd(const std::vector<u8>& command) {
     const char* commands = "Commands:\n"
                            "  get fastmem\n"
                            "  get info\n"
-                           "  get mappings\n";
+                           "  get mappings\n"
+                           "  get svc\n";
 
     if (command_str == "get fastmem") {
         if (Settings::IsFastmemEnabled()) {
@@ -698,6 +700,13 @@ void GDBStub::HandleRcmd(const std::vector<u8>& command) {
 
             cur_addr = next_address;
         }
+    } else if (command_str == "get svc") {
+        const auto& svc_statistics = system.Kernel().GetSvcStatistics();
+        if (svc_statistics.IsRunning()) {
+            reply = svc_statistics.GetReport(16);
+        } else {
+            reply = "SVC statistics are not enabled.\n";
+        }
     } else if (command_str == "help") {
         reply = commands;
     } else {
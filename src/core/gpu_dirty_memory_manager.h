@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <bit>
 #include <functional>
-#include <mutex>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -14,49 +16,49 @@
 
 namespace Core {
 
-class GPUDirtyMemoryManager {
+/**
+ * Tracks the memory written by one CPU core that has to be invalidated in the GPU caches.
+ *
+ * Writes to the page being tracked are merged into an atomic mask of 64 byte blocks. When another
+ * page is written, the tracked page is appended to the buffer of the current epoch, which only
+ * this core writes to. Gather starts a new epoch, so the core continues in the other buffer, and
+ * reads the previous one once the core is no longer appending to it. Collect may only be called
+ * by one thread at a time, and Gather by a single thread.
+ */
+class alignas(64) GPUDirtyMemoryManager {
 public:
     GPUDirtyMemoryManager() : current{default_transform} {
-        back_buffer.reserve(256);
-        front_buffer.reserve(256);
+        for (auto& buffer : buffers) {
+            buffer.reserve(256);
+        }
     }
 
     ~GPUDirtyMemoryManager() = default;
 
     void Collect(PAddr address, size_t size) {
-        TransformAddress t = BuildTransform(address, size);
-        TransformAddress tmp, original;
-        do {
-            tmp = current.load(std::memory_order_acquire);
-            original = tmp;
-            if (tmp.address != t.address) {
-                if (IsValid(tmp.address)) {
-                    std::scoped_lock lk(guard);
-                    back_buffer.emplace_back(tmp);
-                    current.exchange(t, std::memory_order_relaxed);
-                    return;
-                }
-                tmp.address = t.address;
-                tmp.mask = 0;
-            }
-            if ((tmp.mask | t.mask) == tmp.mask) {
-                return;
-            }
-            tmp.mask |= t.mask;
-        } while (!current.compare_exchange_weak(original, tmp, std::memory_order_release,
-                                                std::memory_order_relaxed));
+        // Split writes spanning several pages, the mask of a transform covers a single page
+        while (size > 0) {
+            const size_t chunk_size = std::min(page_size - (address & page_mask), size);
+            CollectPage(BuildTransform(address, chunk_size));
+            address += chunk_size;
+            size -= chunk_size;
+        }
     }
 
     void Gather(std::function<void(PAddr, size_t)>& callback) {
-        {
-            std::scoped_lock lk(guard);
-            TransformAddress t = current.exchange(default_transform, std::memory_order_relaxed);
-            front_buffer.swap(back_buffer);
-            if (IsValid(t.address)) {
-                front_buffer.emplace_back(t);
-            }
+        const u64 gather_epoch = epoch.fetch_add(1, std::memory_order_seq_cst);
+
+        // Wait for the core to leave the buffer of the previous epoch
+        while (active_epoch.load(std::memory_order_seq_cst) == gather_epoch + 1) {
+            std::this_thread::yield();
+        }
+
+        auto& buffer = buffers[gather_epoch % buffers.size()];
+        const TransformAddress t = current.exchange(default_transform, std::memory_order_acquire);
+        if (IsValid(t.address)) {
+            buffer.push_back(t);
         }
-        for (auto& transform : front_buffer) {
+        for (auto& transform : buffer) {
             size_t offset = 0;
             u64 mask = transform.mask;
             while (mask != 0) {
@@ -71,7 +73,7 @@ public:
                 offset += continuous_bits << align_bits;
             }
         }
-        front_buffer.clear();
+        buffer.clear();
     }
 
 private:
@@ -113,10 +115,48 @@ private:
         return result;
     }
 
+    void CollectPage(TransformAddress t) {
+        TransformAddress tmp = current.load(std::memory_order_acquire);
+        while (tmp.address == t.address) {
+            if ((tmp.mask | t.mask) == tmp.mask) {
+                return;
+            }
+            const TransformAddress merged{.address = t.address, .mask = tmp.mask | t.mask};
+            if (current.compare_exchange_weak(tmp, merged, std::memory_order_release,
+                                              std::memory_order_acquire)) {
+                return;
+            }
+        }
+
+        // Start tracking the new page, Gather may have taken the previous one in the meantime
+        const TransformAddress previous = current.exchange(t, std::memory_order_acq_rel);
+        if (IsValid(previous.address)) {
+            Append(previous);
+        }
+    }
+
+    void Append(TransformAddress t) {
+        u64 current_epoch = epoch.load(std::memory_order_seq_cst);
+        while (true) {
+            active_epoch.store(current_epoch + 1, std::memory_order_seq_cst);
+            const u64 new_epoch = epoch.load(std::memory_order_seq_cst);
+            if (new_epoch == current_epoch) {
+                break;
+            }
+            // A gather started, retry on the buffer of the new epoch
+            current_epoch = new_epoch;
+        }
+        buffers[current_epoch % buffers.size()].push_back(t);
+        active_epoch.store(0, std::memory_order_release);
+    }
+
+    // Written by the core
     std::atomic<TransformAddress> current{};
-    std::mutex guard;
-    std::vector<TransformAddress> back_buffer;
-    std::vector<TransformAddress> front_buffer;
+    std::atomic<u64> active_epoch{};
+    std::array<std::vector<TransformAddress>, 2> buffers;
+
+    // Written by the gathering thread
+    alignas(64) std::atomic<u64> epoch{};
 };
 
 } // namespace Core
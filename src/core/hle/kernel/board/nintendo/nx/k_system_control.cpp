@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <mutex>
 #include <random>
 
 #include "common/literals.h"
@@ -176,9 +177,30 @@ u64 GenerateUniformRange(u64 min, u64 max, F f) {
     }
 }
 
+// Seeded generator used instead of the host entropy, so randomized layouts can be reproduced
+std::mutex g_random_mutex;
+std::optional<std::mt19937_64> g_seeded_random;
+
 } // Anonymous namespace
 
+void KSystemControl::SetRandomSeed(std::optional<u64> seed) {
+    std::scoped_lock lk{g_random_mutex};
+    if (seed) {
+        g_seeded_random.emplace(*seed);
+    } else {
+        g_seeded_random.reset();
+    }
+}
+
 u64 KSystemControl::GenerateRandomU64() {
+    {
+        std::scoped_lock lk{g_random_mutex};
+        if (g_seeded_random) {
+            std::uniform_int_distribution<u64> distribution(1, std::numeric_limits<u64>::max());
+            return distribution(*g_seeded_random);
+        }
+    }
+
     std::random_device device;
     std::mt19937 gen(device());
     std::uniform_int_distribution<u64> distribution(1, std::numeric_limits<u64>::max());
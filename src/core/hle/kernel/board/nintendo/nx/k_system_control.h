@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "core/hle/kernel/k_typed_address.h"
 #include "core/hle/result.h"
 
@@ -32,6 +34,7 @@ public:
     };
 
     // Randomness.
+    static void SetRandomSeed(std::optional<u64> seed);
     static u64 GenerateRandomRange(u64 min, u64 max);
     static u64 GenerateRandomU64();
 
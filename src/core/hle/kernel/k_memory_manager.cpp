@@ -507,27 +507,38 @@ bool KMemoryManager::Impl::ProcessOptimizedAllocation(KernelCore& kernel, KPhysi
     auto optimize_pa = KPageTable::GetHeapPhysicalAddress(kernel, m_management_region);
     auto* optimize_map = device_memory.GetPointer<u64>(optimize_pa);
 
+    const auto is_new = [optimize_map](size_t page) {
+        return (optimize_map[page / Common::BitSize<u64>()] &
+                (u64(1) << (page % Common::BitSize<u64>()))) == 0;
+    };
+
     // We want to return whether any pages were newly allocated.
     bool any_new = false;
 
     // Get the range we're processing.
     size_t offset = this->GetPageOffset(block);
-    const size_t last = offset + num_pages - 1;
+    const size_t end = offset + num_pages;
 
     // Process.
-    while (offset <= last) {
-        // Check if the page has been optimized-allocated before.
-        if ((optimize_map[offset / Common::BitSize<u64>()] &
-             (u64(1) << (offset % Common::BitSize<u64>()))) == 0) {
-            // If not, it's new.
-            any_new = true;
-
-            // Fill the page.
-            auto* ptr = device_memory.GetPointer<u8>(m_heap.GetAddress());
-            std::memset(ptr + offset * PageSize, fill_pattern, PageSize);
+    while (offset < end) {
+        // Skip pages that have been optimized-allocated before.
+        if (!is_new(offset)) {
+            offset++;
+            continue;
         }
 
-        offset++;
+        // Find the run of new pages.
+        const size_t run_start = offset;
+        while (offset < end && is_new(offset)) {
+            offset++;
+        }
+        any_new = true;
+
+        // Fill the pages. Clear the whole run at once, so zero fills can release the pages to
+        // the host instead of writing them.
+        const KPhysicalAddress run_address = m_heap.GetAddress() + run_start * PageSize;
+        device_memory.buffer.ClearBackingRegion(GetInteger(run_address) - Core::DramMemoryMap::Base,
+                                                (offset - run_start) * PageSize, fill_pattern);
     }
 
     // Return the number of pages we processed.
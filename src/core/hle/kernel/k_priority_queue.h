@@ -75,74 +75,106 @@ private:
     using Entry = typename Member::QueueEntry;
 
 public:
-    class KPerCoreQueue {
+    // The queues of a core are kept together, on their own cache lines, so that finding and
+    // updating the highest priority member of a core only touches the memory of that core.
+    class alignas(64) KPerCoreQueue {
     private:
-        std::array<Entry, NumCores> m_root{};
+        std::array<Entry, NumPriority> m_root{};
+        Common::BitSet64<NumPriority> m_available_priorities{};
+
+        constexpr Entry& GetEntry(s32 priority, s32 core, Member* member) {
+            return (member != nullptr) ? member->GetPriorityQueueEntry(core) : m_root[priority];
+        }
 
     public:
         constexpr KPerCoreQueue() {
-            for (auto& per_core_root : m_root) {
-                per_core_root.Initialize();
+            for (auto& per_priority_root : m_root) {
+                per_priority_root.Initialize();
             }
         }
 
-        constexpr bool PushBack(s32 core, Member* member) {
+        constexpr bool IsEmpty() const {
+            return m_available_priorities.CountLeadingZero() >= NumPriority;
+        }
+
+        constexpr void PushBack(s32 priority, s32 core, Member* member) {
             // Get the entry associated with the member.
             Entry& member_entry = member->GetPriorityQueueEntry(core);
 
             // Get the entry associated with the end of the queue.
-            Member* tail = m_root[core].GetPrev();
-            Entry& tail_entry =
-                (tail != nullptr) ? tail->GetPriorityQueueEntry(core) : m_root[core];
+            Member* tail = m_root[priority].GetPrev();
+            Entry& tail_entry = this->GetEntry(priority, core, tail);
 
             // Link the entries.
             member_entry.SetPrev(tail);
             member_entry.SetNext(nullptr);
             tail_entry.SetNext(member);
-            m_root[core].SetPrev(member);
+            m_root[priority].SetPrev(member);
 
-            return tail == nullptr;
+            if (tail == nullptr) {
+                m_available_priorities.SetBit(priority);
+            }
         }
 
-        constexpr bool PushFront(s32 core, Member* member) {
+        constexpr void PushFront(s32 priority, s32 core, Member* member) {
             // Get the entry associated with the member.
             Entry& member_entry = member->GetPriorityQueueEntry(core);
 
             // Get the entry associated with the front of the queue.
-            Member* head = m_root[core].GetNext();
-            Entry& head_entry =
-                (head != nullptr) ? head->GetPriorityQueueEntry(core) : m_root[core];
+            Member* head = m_root[priority].GetNext();
+            Entry& head_entry = this->GetEntry(priority, core, head);
 
             // Link the entries.
             member_entry.SetPrev(nullptr);
             member_entry.SetNext(head);
             head_entry.SetPrev(member);
-            m_root[core].SetNext(member);
+            m_root[priority].SetNext(member);
 
-            return (head == nullptr);
+            if (head == nullptr) {
+                m_available_priorities.SetBit(priority);
+            }
         }
 
-        constexpr bool Remove(s32 core, Member* member) {
+        constexpr void Remove(s32 priority, s32 core, Member* member) {
             // Get the entry associated with the member.
             Entry& member_entry = member->GetPriorityQueueEntry(core);
 
             // Get the entries associated with next and prev.
             Member* prev = member_entry.GetPrev();
             Member* next = member_entry.GetNext();
-            Entry& prev_entry =
-                (prev != nullptr) ? prev->GetPriorityQueueEntry(core) : m_root[core];
-            Entry& next_entry =
-                (next != nullptr) ? next->GetPriorityQueueEntry(core) : m_root[core];
+            Entry& prev_entry = this->GetEntry(priority, core, prev);
+            Entry& next_entry = this->GetEntry(priority, core, next);
 
             // Unlink.
             prev_entry.SetNext(next);
             next_entry.SetPrev(prev);
 
-            return (this->GetFront(core) == nullptr);
+            if (this->GetFront(priority) == nullptr) {
+                m_available_priorities.ClearBit(priority);
+            }
         }
 
-        constexpr Member* GetFront(s32 core) const {
-            return m_root[core].GetNext();
+        constexpr Member* GetFront() const {
+            const s32 priority = static_cast<s32>(m_available_priorities.CountLeadingZero());
+            if (priority <= LowestPriority) {
+                return m_root[priority].GetNext();
+            } else {
+                return nullptr;
+            }
+        }
+
+        constexpr Member* GetFront(s32 priority) const {
+            return m_root[priority].GetNext();
+        }
+
+        constexpr Member* GetNextPriorityFront(s32 priority) const {
+            const s32 next_priority =
+                static_cast<s32>(m_available_priorities.GetNextSet(priority));
+            if (next_priority <= LowestPriority) {
+                return m_root[next_priority].GetNext();
+            } else {
+                return nullptr;
+            }
         }
     };
 
@@ -158,9 +190,8 @@ public:
                 return;
             }
 
-            if (m_queues[priority].PushBack(core, member)) {
-                m_available_priorities[core].SetBit(priority);
-            }
+            m_queues[core].PushBack(priority, core, member);
+            m_available_cores |= UINT64_C(1) << core;
         }
 
         constexpr void PushFront(s32 priority, s32 core, Member* member) {
@@ -171,9 +202,8 @@ public:
                 return;
             }
 
-            if (m_queues[priority].PushFront(core, member)) {
-                m_available_priorities[core].SetBit(priority);
-            }
+            m_queues[core].PushFront(priority, core, member);
+            m_available_cores |= UINT64_C(1) << core;
         }
 
         constexpr void Remove(s32 priority, s32 core, Member* member) {
@@ -184,20 +214,16 @@ public:
                 return;
             }
 
-            if (m_queues[priority].Remove(core, member)) {
-                m_available_priorities[core].ClearBit(priority);
+            m_queues[core].Remove(priority, core, member);
+            if (m_queues[core].IsEmpty()) {
+                m_available_cores &= ~(UINT64_C(1) << core);
             }
         }
 
         constexpr Member* GetFront(s32 core) const {
             ASSERT(IsValidCore(core));
 
-            const s32 priority = static_cast<s32>(m_available_priorities[core].CountLeadingZero());
-            if (priority <= LowestPriority) {
-                return m_queues[priority].GetFront(core);
-            } else {
-                return nullptr;
-            }
+            return m_queues[core].GetFront();
         }
 
         constexpr Member* GetFront(s32 priority, s32 core) const {
@@ -205,7 +231,7 @@ public:
             ASSERT(IsValidPriority(priority));
 
             if (priority <= LowestPriority) {
-                return m_queues[priority].GetFront(core);
+                return m_queues[core].GetFront(priority);
             } else {
                 return nullptr;
             }
@@ -216,11 +242,7 @@ public:
 
             Member* next = member->GetPriorityQueueEntry(core).GetNext();
             if (next == nullptr) {
-                const s32 priority = static_cast<s32>(
-                    m_available_priorities[core].GetNextSet(member->GetPriority()));
-                if (priority <= LowestPriority) {
-                    next = m_queues[priority].GetFront(core);
-                }
+                next = m_queues[core].GetNextPriorityFront(member->GetPriority());
             }
             return next;
         }
@@ -230,8 +252,8 @@ public:
             ASSERT(IsValidPriority(priority));
 
             if (priority <= LowestPriority) {
-                m_queues[priority].Remove(core, member);
-                m_queues[priority].PushFront(core, member);
+                m_queues[core].Remove(priority, core, member);
+                m_queues[core].PushFront(priority, core, member);
             }
         }
 
@@ -240,17 +262,22 @@ public:
             ASSERT(IsValidPriority(priority));
 
             if (priority <= LowestPriority) {
-                m_queues[priority].Remove(core, member);
-                m_queues[priority].PushBack(core, member);
-                return m_queues[priority].GetFront(core);
+                m_queues[core].Remove(priority, core, member);
+                m_queues[core].PushBack(priority, core, member);
+                return m_queues[core].GetFront(priority);
             } else {
                 return nullptr;
             }
         }
 
+        /// Returns a mask of the cores that have at least one member queued
+        constexpr u64 GetAvailableCores() const {
+            return m_available_cores;
+        }
+
     private:
-        std::array<KPerCoreQueue, NumPriority> m_queues{};
-        std::array<Common::BitSet64<NumPriority>, NumCores> m_available_priorities{};
+        std::array<KPerCoreQueue, NumCores> m_queues{};
+        u64 m_available_cores{};
     };
 
 private:
@@ -349,6 +376,10 @@ public:
         return member->GetPriorityQueueEntry(core).GetNext();
     }
 
+    constexpr u64 GetSuggestedCores() const {
+        return m_suggested_queue.GetAvailableCores();
+    }
+
     // Mutators.
     constexpr void PushBack(Member* member) {
         // This is for host (dummy) threads that we do not want to enter the priority queue.
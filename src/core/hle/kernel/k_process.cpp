@@ -117,8 +117,8 @@ public:
 };
 
 void GenerateRandom(std::span<u64> out_random) {
-    std::mt19937 rng(Settings::values.rng_seed_enabled ? Settings::values.rng_seed.GetValue()
-                                                       : static_cast<u32>(std::time(nullptr)));
+    std::mt19937 rng(Settings::IsRngSeedEnabled() ? Settings::values.rng_seed.GetValue()
+                                                   : static_cast<u32>(std::time(nullptr)));
     std::uniform_int_distribution<u64> distribution;
     std::generate(out_random.begin(), out_random.end(), [&] { return distribution(rng); });
 }
@@ -269,6 +269,7 @@ Result KProcess::Initialize(const Svc::CreateProcessParameter& params, const KPa
            static_cast<size_t>(params.code_num_pages));
 
     // Set members.
+    m_creation_time = std::chrono::steady_clock::now();
     m_memory_pool = pool;
     m_is_default_application_system_resource = false;
     m_is_immortal = immortal;
@@ -356,6 +357,7 @@ Result KProcess::Initialize(const Svc::CreateProcessParameter& params,
     ASSERT(res_limit != nullptr);
 
     // Set members.
+    m_creation_time = std::chrono::steady_clock::now();
     m_memory_pool = pool;
     m_is_default_application_system_resource = false;
     m_is_immortal = false;
@@ -1144,6 +1146,14 @@ Result KProcess::GetThreadList(s32* out_num_threads, KProcessAddress out_thread_
 
 void KProcess::Switch(KProcess* cur_process, KProcess* next_process) {}
 
+void KProcess::LogFirstSupervisorCall() const {
+    // Covers loading the code and setting up the address space, a useful measure of boot time
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - m_creation_time);
+    LOG_INFO(Kernel, "Process {} ({:016X}) made its first SVC {} ms after creation",
+             m_name.data(), m_program_id, elapsed.count());
+}
+
 KProcess::KProcess(KernelCore& kernel)
     : KAutoObjectWithSlabHeapAndContainer(kernel), m_page_table{kernel}, m_state_lock{kernel},
       m_list_lock{kernel}, m_cond_var{kernel.System()}, m_address_arbiter{kernel.System()},
@@ -1275,10 +1285,23 @@ void KProcess::InitializeInterfaces() {
     } else
 #endif
         if (this->Is64Bit()) {
+        // Without multicore, cores take turns on a single host thread and can share one JIT,
+        // translating every block only once.
+        const bool share_jit = !m_kernel.IsMulticore() && (!Settings::values.cpu_debug_mode ||
+                                                           Settings::values.cpuopt_shared_jit);
+        Core::ArmDynarmic64* shared_jit_core = nullptr;
         for (size_t i = 0; i < Core::Hardware::NUM_CPU_CORES; i++) {
-            m_arm_interfaces[i] = std::make_unique<Core::ArmDynarmic64>(
+            auto interface = std::make_unique<Core::ArmDynarmic64>(
                 m_kernel.System(), m_kernel.IsMulticore(), this,
-                static_cast<Core::DynarmicExclusiveMonitor&>(*m_exclusive_monitor), i);
+                static_cast<Core::DynarmicExclusiveMonitor&>(*m_exclusive_monitor), i,
+                shared_jit_core);
+            if (share_jit && shared_jit_core == nullptr) {
+                shared_jit_core = interface.get();
+            }
+            m_arm_interfaces[i] = std::move(interface);
+        }
+        if (share_jit) {
+            LOG_INFO(Kernel, "Cores of process {} share a single JIT code cache", m_process_id);
         }
     } else {
         for (size_t i = 0; i < Core::Hardware::NUM_CPU_CORES; i++) {
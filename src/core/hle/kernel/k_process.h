@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 
 #include "core/arm/arm_interface.h"
@@ -117,6 +118,7 @@ private:
     std::array<DebugWatchpoint, Core::Hardware::NUM_WATCHPOINTS> m_watchpoints{};
     std::map<KProcessAddress, u64> m_debug_page_refcounts{};
     std::atomic<s64> m_cpu_time{};
+    std::chrono::steady_clock::time_point m_creation_time{};
     std::atomic<s64> m_num_process_switches{};
     std::atomic<s64> m_num_thread_switches{};
     std::atomic<s64> m_num_fpu_switches{};
@@ -134,6 +136,8 @@ private:
     Result StartTermination();
     void FinishTermination();
 
+    void LogFirstSupervisorCall() const;
+
     void PinThread(s32 core_id, KThread* thread) {
         ASSERT(0 <= core_id && core_id < static_cast<s32>(Core::Hardware::NUM_CPU_CORES));
         ASSERT(thread != nullptr);
@@ -355,6 +359,12 @@ public:
     void IncrementRunningThreadCount();
     void DecrementRunningThreadCount();
 
+    void IncrementSupervisorCallCount() {
+        if (m_num_supervisor_calls.fetch_add(1, std::memory_order_relaxed) == 0) [[unlikely]] {
+            this->LogFirstSupervisorCall();
+        }
+    }
+
     size_t GetRequiredSecureMemorySizeNonDefault() const {
         if (!this->IsDefaultApplicationSystemResource() && m_system_resource->IsSecureResource()) {
             auto* secure_system_resource = static_cast<KSecureSystemResource*>(m_system_resource);
@@ -40,6 +40,14 @@ public:
 
     bool IsLight() const;
 
+    /// Marks the port as served by an HLE service, so are the sessions it creates
+    void SetHle() {
+        m_is_hle = true;
+    }
+    bool IsHle() const {
+        return m_is_hle;
+    }
+
     // Overridden virtual functions.
     void Destroy() override;
     bool IsSignaled() const override;
@@ -53,6 +61,7 @@ private:
     SessionList m_session_list{};
     LightSessionList m_light_session_list{};
     KPort* m_parent{};
+    bool m_is_hle{};
 };
 
 } // namespace Kernel
@@ -1150,6 +1150,7 @@ Result KServerSession::ReceiveRequest(uintptr_t server_message, uintptr_t server
             std::make_shared<Service::HLERequestContext>(m_kernel, memory, this, client_thread);
         (*out_context)->SetSessionRequestManager(manager);
         (*out_context)->PopulateFromIncomingCommandBuffer(cmd_buf);
+        (*out_context)->SetRequestTime(request->GetSendTime());
         // We succeeded.
         R_SUCCEED();
     } else {
@@ -1321,6 +1322,9 @@ Result KServerSession::SendReply(uintptr_t server_message, uintptr_t server_buff
         }
     }
 
+    // The client was answered, so the request no longer holds back virtual time.
+    request->EndHleRequest();
+
     R_RETURN(result);
 }
 
@@ -1344,6 +1348,9 @@ Result KServerSession::OnRequest(KSessionRequest* request) {
         // Add the request to the list.
         request->Open();
         m_request_list.push_back(*request);
+        if (m_is_hle) {
+            request->BeginHleRequest();
+        }
 
         // If we were empty, signal.
         if (was_empty) {
@@ -1441,6 +1448,8 @@ void KServerSession::CleanupRequests() {
                 }
             }
         }
+
+        request->EndHleRequest();
     }
 }
 
@@ -1533,6 +1542,11 @@ void KServerSession::OnClientClosed() {
             // Signal the event.
             event->Signal();
         }
+
+        // The current request is still answered by its server.
+        if (!cur_request) {
+            request->EndHleRequest();
+        }
     }
 
     // Notify.
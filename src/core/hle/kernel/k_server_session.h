@@ -46,6 +46,11 @@ public:
         return m_parent;
     }
 
+    /// Marks the session as served by an HLE service, its requests are counted by the kernel
+    void SetHle() {
+        m_is_hle = true;
+    }
+
     bool IsSignaled() const override;
     void OnClientClosed();
 
@@ -79,6 +84,8 @@ private:
     KSessionRequest* m_current_request{};
 
     KLightLock m_lock;
+
+    bool m_is_hle{};
 };
 
 } // namespace Kernel
@@ -3,6 +3,7 @@
 
 #include "core/hle/kernel/k_client_port.h"
 #include "core/hle/kernel/k_client_session.h"
+#include "core/hle/kernel/k_port.h"
 #include "core/hle/kernel/k_scoped_resource_reservation.h"
 #include "core/hle/kernel/k_server_session.h"
 #include "core/hle/kernel/k_session.h"
@@ -27,6 +28,9 @@ void KSession::Initialize(KClientPort* client_port, uintptr_t name) {
     // Initialize our sub sessions.
     m_server.Initialize(this);
     m_client.Initialize(this);
+    if (client_port != nullptr && client_port->GetParent()->GetServerPort().IsHle()) {
+        m_server.SetHle();
+    }
 
     // Set state and name.
     this->SetState(State::Normal);
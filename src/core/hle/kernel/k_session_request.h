@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <chrono>
+#include <utility>
 
 #include "common/intrusive_list.h"
 
@@ -186,6 +188,7 @@ public:
         m_event = event;
         m_address = address;
         m_size = size;
+        m_send_time = std::chrono::steady_clock::now();
 
         m_thread->Open();
         if (m_event != nullptr) {
@@ -207,6 +210,9 @@ public:
     size_t GetSize() const {
         return m_size;
     }
+    std::chrono::steady_clock::time_point GetSendTime() const {
+        return m_send_time;
+    }
     KProcess* GetServerProcess() const {
         return m_server;
     }
@@ -216,6 +222,17 @@ public:
         m_server->Open();
     }
 
+    // Requests to HLE services are counted by the kernel until they are answered
+    void BeginHleRequest() {
+        m_is_hle = true;
+        m_kernel.BeginHleRequest();
+    }
+    void EndHleRequest() {
+        if (std::exchange(m_is_hle, false)) {
+            m_kernel.EndHleRequest();
+        }
+    }
+
     void ClearThread() {
         m_thread = nullptr;
     }
@@ -291,6 +308,7 @@ private:
     // NOTE: This is public and virtual in Nintendo's kernel.
     void Finalize() override {
         m_mappings.Finalize();
+        this->EndHleRequest();
 
         if (m_thread) {
             m_thread->Close();
@@ -310,6 +328,8 @@ private:
     KEvent* m_event{};
     uintptr_t m_address{};
     size_t m_size{};
+    std::chrono::steady_clock::time_point m_send_time{};
+    bool m_is_hle{};
 };
 
 } // namespace Kernel
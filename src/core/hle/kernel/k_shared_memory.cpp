@@ -60,7 +60,9 @@ Result KSharedMemory::Initialize(Core::DeviceMemory& device_memory, KProcess* ow
 
     // Clear all pages in the memory.
     for (const auto& block : *m_page_group) {
-        std::memset(m_device_memory->GetPointer<void>(block.GetAddress()), 0, block.GetSize());
+        m_device_memory->buffer.ClearBackingRegion(GetInteger(block.GetAddress()) -
+                                                       Core::DramMemoryMap::Base,
+                                                   block.GetSize(), 0);
     }
 
     R_SUCCEED();
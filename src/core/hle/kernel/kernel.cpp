@@ -4,8 +4,11 @@
 #include <array>
 #include <atomic>
 #include <bitset>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <thread>
 #include <unordered_set>
 #include <utility>
@@ -14,6 +17,7 @@
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "common/thread_worker.h"
 #include "core/arm/arm_interface.h"
@@ -41,6 +45,7 @@
 #include "core/hle/kernel/k_worker_task_manager.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
+#include "core/hle/kernel/svc_statistics.h"
 #include "core/hle/result.h"
 #include "core/hle/service/server_manager.h"
 #include "core/hle/service/sm/sm.h"
@@ -71,6 +76,13 @@ struct KernelCore::Impl {
 
         is_phantom_mode_for_singlecore = false;
 
+        // Replays lay out the address spaces the same way on every run
+        std::optional<u64> random_seed;
+        if (Settings::values.deterministic_replay) {
+            random_seed = Settings::values.rng_seed.GetValue();
+        }
+        KSystemControl::SetRandomSeed(random_seed);
+
         // Derive the initial memory layout from the emulated board
         Init::InitializeSlabResourceCounts(kernel);
         DeriveInitialMemoryLayout();
@@ -841,6 +853,11 @@ struct KernelCore::Impl {
     u32 single_core_thread_id{};
 
     std::array<u64, Core::Hardware::NUM_CPU_CORES> svc_ticks{};
+    SvcStatistics svc_statistics;
+
+    std::mutex hle_request_mutex;
+    std::condition_variable hle_request_cv;
+    s64 num_hle_requests{};
 
     KWorkerTaskManager worker_task_manager;
 
@@ -1286,6 +1303,14 @@ void KernelCore::ExitSVCProfile() {
     MicroProfileLeave(MICROPROFILE_TOKEN(Kernel_SVC), impl->svc_ticks[CurrentPhysicalCoreIndex()]);
 }
 
+SvcStatistics& KernelCore::GetSvcStatistics() {
+    return impl->svc_statistics;
+}
+
+const SvcStatistics& KernelCore::GetSvcStatistics() const {
+    return impl->svc_statistics;
+}
+
 Init::KSlabResourceCounts& KernelCore::SlabResourceCounts() {
     return impl->slab_resource_counts;
 }
@@ -1306,6 +1331,25 @@ const KMemoryLayout& KernelCore::MemoryLayout() const {
     return *impl->memory_layout;
 }
 
+void KernelCore::BeginHleRequest() {
+    std::scoped_lock lk{impl->hle_request_mutex};
+    ++impl->num_hle_requests;
+}
+
+void KernelCore::EndHleRequest() {
+    std::scoped_lock lk{impl->hle_request_mutex};
+    ASSERT(impl->num_hle_requests > 0);
+    if (--impl->num_hle_requests == 0) {
+        impl->hle_request_cv.notify_all();
+    }
+}
+
+bool KernelCore::WaitForHleRequests(std::chrono::milliseconds timeout) {
+    std::unique_lock lk{impl->hle_request_mutex};
+    return impl->hle_request_cv.wait_for(lk, timeout,
+                                         [this] { return impl->num_hle_requests == 0; });
+}
+
 bool KernelCore::IsPhantomModeForSingleCore() const {
     return impl->IsPhantomModeForSingleCore();
 }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <functional>
 #include <list>
 #include <memory>
@@ -72,6 +73,7 @@ class KTransferMemory;
 class KWorkerTaskManager;
 class KCodeMemory;
 class PhysicalCore;
+class SvcStatistics;
 
 namespace Init {
 struct KSlabResourceCounts;
@@ -275,6 +277,17 @@ public:
 
     void ExitSVCProfile();
 
+    /// Gets the statistics of the supervisor calls made by guest threads.
+    SvcStatistics& GetSvcStatistics();
+    const SvcStatistics& GetSvcStatistics() const;
+
+    /// Counts the requests sent to HLE services that were not answered yet.
+    void BeginHleRequest();
+    void EndHleRequest();
+
+    /// Waits until all requests to HLE services were answered, returns false on timeout.
+    bool WaitForHleRequests(std::chrono::milliseconds timeout);
+
     /// Workaround for single-core mode when preempting threads while idle.
     bool IsPhantomModeForSingleCore() const;
     void SetIsPhantomModeForSingleCore(bool value);
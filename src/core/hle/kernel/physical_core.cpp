@@ -1,8 +1,11 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <utility>
+
 #include "common/scope_exit.h"
 #include "common/settings.h"
+#include "core/arm/guest_profiler.h"
 #include "core/core.h"
 #include "core/debugger/debugger.h"
 #include "core/hle/kernel/k_process.h"
@@ -60,6 +63,9 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
         m_current_thread = nullptr;
 
         system.ExitCPUProfile();
+
+        // Report whether the guest profiler asked for a sample while we were running.
+        return std::exchange(m_is_sample_requested, false);
     };
 
     while (true) {
@@ -78,6 +84,7 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
 
         // Otherwise, run the thread.
         Core::HaltReason hr{};
+        bool sample_requested{};
         {
             // If we were interrupted, exit immediately.
             if (!EnterContext()) {
@@ -94,7 +101,14 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
                 hr = interface->RunThread(thread);
             }
 
-            ExitContext();
+            sample_requested = ExitContext();
+        }
+
+        // Record a profiler sample now that the context can be read safely.
+        if (sample_requested) {
+            Kernel::Svc::ThreadContext ctx{};
+            interface->GetContext(ctx);
+            system.GetGuestProfiler().AddSample(process, ctx);
         }
 
         // Determine why we stopped.
@@ -140,6 +154,10 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
 
         // Handle external interrupt sources.
         if (interrupt || m_is_single_core) {
+            // A halt requested only to take a sample resumes the thread directly.
+            if (sample_requested && !m_is_single_core && !IsInterrupted()) {
+                continue;
+            }
             return;
         }
     }
@@ -203,9 +221,27 @@ void PhysicalCore::LogBacktrace() {
     }
 }
 
+namespace {
+s64 GetHostTimeNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // Anonymous namespace
+
 void PhysicalCore::Idle() {
-    std::unique_lock lk{m_guard};
-    m_on_interrupt.wait(lk, [this] { return m_is_interrupted; });
+    // Block on the interrupt flag itself, which is a futex wait on hosts that provide one, so a
+    // parked core uses no host CPU time until Interrupt is called.
+    const s64 park_time = GetHostTimeNs();
+    m_is_interrupted.wait(false);
+    const s64 wake_time = GetHostTimeNs();
+
+    m_parked_time.fetch_add(wake_time - park_time, std::memory_order_relaxed);
+    const s64 interrupt_time = m_interrupt_time.load(std::memory_order_relaxed);
+    if (interrupt_time >= park_time) {
+        m_num_wakeups.fetch_add(1, std::memory_order_relaxed);
+        m_wake_latency.fetch_add(wake_time - interrupt_time, std::memory_order_relaxed);
+    }
 }
 
 bool PhysicalCore::IsInterrupted() const {
@@ -213,6 +249,8 @@ bool PhysicalCore::IsInterrupted() const {
 }
 
 void PhysicalCore::Interrupt() {
+    const s64 interrupt_time = GetHostTimeNs();
+
     // Lock core context.
     std::scoped_lock lk{m_guard};
 
@@ -221,10 +259,11 @@ void PhysicalCore::Interrupt() {
     auto* thread = m_current_thread;
 
     // Add interrupt flag.
+    m_interrupt_time.store(interrupt_time, std::memory_order_relaxed);
     m_is_interrupted = true;
 
-    // Interrupt ourselves.
-    m_on_interrupt.notify_one();
+    // Wake ourselves if we are parked.
+    m_is_interrupted.notify_one();
 
     // If there is no thread running, we are done.
     if (arm_interface == nullptr) {
@@ -235,6 +274,36 @@ void PhysicalCore::Interrupt() {
     arm_interface->SignalInterrupt(thread);
 }
 
+void PhysicalCore::RequestSample() {
+    // Lock core context.
+    std::scoped_lock lk{m_guard};
+
+    // In single core mode the sampling event runs on the thread that runs every core, between
+    // their time slices. Leave the request pending, the core takes the sample at the end of its
+    // next slice.
+    if (m_is_single_core) {
+        m_is_sample_requested = true;
+        return;
+    }
+
+    // If there is no thread running, there is nothing to sample.
+    if (m_arm_interface == nullptr) {
+        return;
+    }
+
+    // Halt the CPU, the sample is taken once it leaves guest code.
+    m_is_sample_requested = true;
+    m_arm_interface->SignalInterrupt(m_current_thread);
+}
+
+PhysicalCore::IdleStatistics PhysicalCore::GetAndResetIdleStatistics() {
+    return {
+        .parked_time = std::chrono::nanoseconds{m_parked_time.exchange(0)},
+        .num_wakeups = m_num_wakeups.exchange(0),
+        .wake_latency = std::chrono::nanoseconds{m_wake_latency.exchange(0)},
+    };
+}
+
 void PhysicalCore::ClearInterrupt() {
     std::scoped_lock lk{m_guard};
     m_is_interrupted = false;
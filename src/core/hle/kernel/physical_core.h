@@ -3,7 +3,8 @@
 
 #pragma once
 
-#include <condition_variable>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -23,6 +24,15 @@ namespace Kernel {
 
 class PhysicalCore {
 public:
+    struct IdleStatistics {
+        /// Time the host thread spent parked waiting for an interrupt
+        std::chrono::nanoseconds parked_time{};
+        /// Number of times an interrupt woke the parked host thread
+        u64 num_wakeups{};
+        /// Total time between those interrupts and the host thread resuming
+        std::chrono::nanoseconds wake_latency{};
+    };
+
     PhysicalCore(KernelCore& kernel, std::size_t core_index);
     ~PhysicalCore();
 
@@ -46,7 +56,7 @@ public:
     // Log backtrace of current processor state.
     void LogBacktrace();
 
-    // Wait for an interrupt.
+    // Park the host thread until this core is interrupted.
     void Idle();
 
     // Interrupt this core.
@@ -58,6 +68,12 @@ public:
     // Check if this core is interrupted.
     bool IsInterrupted() const;
 
+    // Ask this core to record a profiler sample of the guest thread it is running.
+    void RequestSample();
+
+    // Returns the idle statistics accumulated since the previous call.
+    IdleStatistics GetAndResetIdleStatistics();
+
     std::size_t CoreIndex() const {
         return m_core_index;
     }
@@ -67,10 +83,14 @@ private:
     const std::size_t m_core_index;
 
     std::mutex m_guard;
-    std::condition_variable m_on_interrupt;
     Core::ArmInterface* m_arm_interface{};
     KThread* m_current_thread{};
-    bool m_is_interrupted{};
+    std::atomic<bool> m_is_interrupted{};
+    std::atomic<s64> m_interrupt_time{};
+    std::atomic<s64> m_parked_time{};
+    std::atomic<u64> m_num_wakeups{};
+    std::atomic<s64> m_wake_latency{};
+    bool m_is_sample_requested{};
     bool m_is_single_core{};
 };
 
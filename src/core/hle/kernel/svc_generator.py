@@ -539,6 +539,9 @@ void SvcWrap_CallSecureMonitor64(Core::System& system, std::span<uint64_t, 8> ar
 // Perform a supervisor call by index.
 void Call(Core::System& system, u32 imm);
 
+// Returns the name of a supervisor call, or nullptr if it is unknown.
+const char* GetSvcName(u32 imm);
+
 } // namespace Kernel::Svc
 """
 
@@ -549,6 +552,7 @@ PROLOGUE_CPP = """
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_statistics.h"
 
 namespace Kernel::Svc {
 
@@ -596,14 +600,31 @@ void Call(Core::System& system, u32 imm) {
 
     std::array<uint64_t, 8> args;
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
+    process.IncrementSupervisorCallCount();
     kernel.EnterSVCProfile();
 
+    auto& svc_statistics = kernel.GetSvcStatistics();
+    const bool is_recording = svc_statistics.IsRunning();
+    std::array<uint64_t, 8> call_args;
+    std::chrono::steady_clock::time_point start_time{};
+    if (is_recording) {
+        // The handlers overwrite args with their results, keep the inputs for the record
+        call_args = args;
+        start_time = std::chrono::steady_clock::now();
+    }
+
     if (process.Is64Bit()) {
         Call64(system, imm, args);
     } else {
         Call32(system, imm, args);
     }
 
+    if (is_recording) {
+        svc_statistics.Record(kernel.CurrentPhysicalCoreIndex(), imm,
+                              GetCurrentThread(kernel).GetThreadId(), call_args,
+                              std::chrono::steady_clock::now() - start_time);
+    }
+
     kernel.ExitSVCProfile();
     kernel.CurrentPhysicalCore().LoadSvcArguments(process, args);
 }
@@ -634,6 +655,25 @@ def emit_call(bitness, names, suffix):
     return "\n".join(lines)
 
 
+def emit_names(names):
+    indent = "    "
+    lines = [
+        "const char* GetSvcName(u32 imm) {",
+        f"{indent}switch (static_cast<SvcId>(imm)) {{"
+    ]
+
+    for _, name in names:
+        lines.append(f"{indent}case SvcId::{name}:")
+        lines.append(f"{indent*2}return \"{name}\";")
+
+    lines.append(f"{indent}default:")
+    lines.append(f"{indent*2}return nullptr;")
+    lines.append(f"{indent}}}")
+    lines.append("}")
+
+    return "\n".join(lines)
+
+
 def build_fn_declaration(return_type, name, arguments):
     arg_list = ["Core::System& system"]
     for arg in arguments:
@@ -690,6 +730,7 @@ def main():
 
     call_32 = emit_call(BIT_32, names, SUFFIX_NAMES[BIT_32])
     call_64 = emit_call(BIT_64, names, SUFFIX_NAMES[BIT_64])
+    svc_names = emit_names(names)
     enum_decls = build_enum_declarations()
 
     with open("svc.h", "w") as f:
@@ -714,6 +755,8 @@ def main():
         f.write(call_32)
         f.write("\n\n")
         f.write(call_64)
+        f.write("\n\n")
+        f.write(svc_names)
         f.write(EPILOGUE_CPP)
 
     print(f"Done (emitted {len(names)} definitions)")
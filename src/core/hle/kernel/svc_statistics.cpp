@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <fstream>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_statistics.h"
+
+namespace Kernel {
+namespace {
+std::string GetName(u32 svc_id) {
+    const char* name = Svc::GetSvcName(svc_id);
+    return name ? fmt::format("{} ({:#x})", name, svc_id) : fmt::format("Unknown ({:#x})", svc_id);
+}
+
+double ToMilliseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+double ToMicroseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::micro>(time).count();
+}
+} // Anonymous namespace
+
+SvcStatistics::SvcStatistics() = default;
+
+SvcStatistics::~SvcStatistics() = default;
+
+void SvcStatistics::Start() {
+    for (auto& core : cores) {
+        std::scoped_lock lk{core.mutex};
+        core.entries = {};
+        core.num_records = 0;
+    }
+    is_running.store(true, std::memory_order_relaxed);
+}
+
+void SvcStatistics::Stop() {
+    is_running.store(false, std::memory_order_relaxed);
+}
+
+void SvcStatistics::Record(size_t core, u32 svc_id, u64 thread_id, std::span<const u64, 8> args,
+                           std::chrono::nanoseconds host_time) {
+    CoreData& data = cores[core];
+    std::scoped_lock lk{data.mutex};
+
+    TraceRecord& record = data.trace[data.num_records++ % TraceSize];
+    record.svc_id = svc_id;
+    record.thread_id = thread_id;
+    std::ranges::copy(args, record.args.begin());
+    record.host_time = host_time;
+
+    if (svc_id >= Svc::NumSupervisorCalls) {
+        return;
+    }
+    Entry& entry = data.entries[svc_id];
+    ++entry.num_calls;
+    entry.total_time += host_time;
+    entry.max_time = std::max(entry.max_time, host_time);
+}
+
+std::vector<SvcStatistics::Entry> SvcStatistics::GetEntries() const {
+    std::array<Entry, Svc::NumSupervisorCalls> totals{};
+    for (const auto& core : cores) {
+        std::scoped_lock lk{core.mutex};
+        for (size_t svc_id = 0; svc_id < totals.size(); ++svc_id) {
+            const Entry& entry = core.entries[svc_id];
+            totals[svc_id].num_calls += entry.num_calls;
+            totals[svc_id].total_time += entry.total_time;
+            totals[svc_id].max_time = std::max(totals[svc_id].max_time, entry.max_time);
+        }
+    }
+
+    std::vector<Entry> result;
+    for (size_t svc_id = 0; svc_id < totals.size(); ++svc_id) {
+        if (totals[svc_id].num_calls == 0) {
+            continue;
+        }
+        totals[svc_id].svc_id = static_cast<u32>(svc_id);
+        result.push_back(totals[svc_id]);
+    }
+    std::ranges::sort(result, [](const Entry& lhs, const Entry& rhs) {
+        return lhs.total_time > rhs.total_time;
+    });
+    return result;
+}
+
+std::vector<SvcStatistics::TraceRecord> SvcStatistics::GetTrace(size_t core) const {
+    const CoreData& data = cores[core];
+    std::scoped_lock lk{data.mutex};
+
+    const u64 num_records = std::min<u64>(data.num_records, TraceSize);
+    std::vector<TraceRecord> result;
+    result.reserve(num_records);
+    for (u64 index = data.num_records - num_records; index < data.num_records; ++index) {
+        result.push_back(data.trace[index % TraceSize]);
+    }
+    return result;
+}
+
+std::string SvcStatistics::GetReport(size_t num_records) const {
+    std::string report = fmt::format("{:<40} {:>10} {:>12} {:>10} {:>10}\n", "svc", "calls",
+                                     "total ms", "mean us", "max us");
+    for (const auto& entry : GetEntries()) {
+        report += fmt::format("{:<40} {:>10} {:>12.3f} {:>10.1f} {:>10.1f}\n",
+                              GetName(entry.svc_id), entry.num_calls,
+                              ToMilliseconds(entry.total_time),
+                              ToMicroseconds(entry.total_time) /
+                                  static_cast<double>(entry.num_calls),
+                              ToMicroseconds(entry.max_time));
+    }
+
+    for (size_t core = 0; core < cores.size(); ++core) {
+        const auto trace = GetTrace(core);
+        const size_t first = trace.size() - std::min(trace.size(), num_records);
+        if (first == trace.size()) {
+            continue;
+        }
+        report += fmt::format("\nlast calls of core {}:\n", core);
+        for (size_t index = first; index < trace.size(); ++index) {
+            const TraceRecord& record = trace[index];
+            report += fmt::format("  thread {:<6} {:<40} {:>10.1f} us  {:#x}\n", record.thread_id,
+                                  GetName(record.svc_id), ToMicroseconds(record.host_time),
+                                  fmt::join(record.args, " "));
+        }
+    }
+    return report;
+}
+
+void SvcStatistics::WriteReport(const std::filesystem::path& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        LOG_ERROR(Kernel_SVC, "Failed to open SVC statistics {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    file << GetReport(TraceSize);
+
+    LOG_INFO(Kernel_SVC, "Wrote SVC statistics to {}", Common::FS::PathToUTF8String(path));
+}
+
+} // namespace Kernel
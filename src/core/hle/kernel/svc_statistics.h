@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/hardware_properties.h"
+#include "core/hle/kernel/svc_types.h"
+
+namespace Kernel {
+
+/**
+ * Host side trace of supervisor calls.
+ *
+ * Every physical core keeps its most recent calls in a ring buffer, and accumulates the number of
+ * calls and the host time spent per SVC. Time is measured from the moment the guest made the call
+ * until it returns to the guest, so calls that block include the time they waited. A core only
+ * takes its own lock, so recording does not contend with the other cores.
+ */
+class SvcStatistics {
+public:
+    /// Number of calls kept in the trace of each core
+    static constexpr size_t TraceSize = 1024;
+
+    struct TraceRecord {
+        u32 svc_id{};
+        u64 thread_id{};
+        std::array<u64, 8> args{};
+        std::chrono::nanoseconds host_time{};
+    };
+
+    struct Entry {
+        u32 svc_id{};
+        u64 num_calls{};
+        std::chrono::nanoseconds total_time{};
+        std::chrono::nanoseconds max_time{};
+    };
+
+    SvcStatistics();
+    ~SvcStatistics();
+
+    /// Clears the previous statistics and starts recording calls
+    void Start();
+
+    /// Stops recording, recorded statistics are kept until the next Start
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const {
+        return is_running.load(std::memory_order_relaxed);
+    }
+
+    /// Records a call that returned on the given core, args are the arguments of the call
+    void Record(size_t core, u32 svc_id, u64 thread_id, std::span<const u64, 8> args,
+                std::chrono::nanoseconds host_time);
+
+    /// Returns the statistics of all cores, sorted by decreasing total time
+    [[nodiscard]] std::vector<Entry> GetEntries() const;
+
+    /// Returns the most recent calls of a core, oldest first
+    [[nodiscard]] std::vector<TraceRecord> GetTrace(size_t core) const;
+
+    /// Formats the statistics, followed by the last num_records calls of every core
+    [[nodiscard]] std::string GetReport(size_t num_records) const;
+
+    /// Writes the statistics and the full traces
+    void WriteReport(const std::filesystem::path& path) const;
+
+private:
+    struct alignas(64) CoreData {
+        mutable std::mutex mutex;
+        std::array<Entry, Svc::NumSupervisorCalls> entries{};
+        std::array<TraceRecord, TraceSize> trace{};
+        u64 num_records{};
+    };
+
+    std::atomic_bool is_running{};
+    std::array<CoreData, Core::Hardware::NUM_CPU_CORES> cores;
+};
+
+} // namespace Kernel
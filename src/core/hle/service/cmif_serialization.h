@@ -338,12 +338,21 @@ void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLE
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
             using ElementType = typename ArgType::Type;
 
-            // Set up scratch buffer.
-            auto& buffer = temp[OutBufferIndex];
+            // Map the output buffer in place when possible, otherwise set up a scratch buffer.
+            std::span<u8> buffer{};
             if (ctx.CanWriteBuffer(OutBufferIndex)) {
-                buffer.resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
-            } else {
-                buffer.resize_destructive(0);
+                if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
+                    buffer = ctx.GetWriteBufferSpan(OutBufferIndex);
+                } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
+                    buffer = ctx.GetWriteBufferSpanB(OutBufferIndex);
+                } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
+                    buffer = ctx.GetWriteBufferSpanC(OutBufferIndex);
+                }
+                if (buffer.empty() ||
+                    reinterpret_cast<uintptr_t>(buffer.data()) % alignof(ElementType) != 0) {
+                    temp[OutBufferIndex].resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
+                    buffer = temp[OutBufferIndex];
+                }
             }
 
             ElementType* ptr = (ElementType*) buffer.data();
@@ -412,7 +421,8 @@ void WriteOutArgument(bool is_domain, CallArguments& args, u8* raw_data, HLERequ
 
             return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
-            auto& buffer = temp[OutBufferIndex];
+            // Buffers mapped in place are recognized by the context and not copied again.
+            const auto buffer = std::as_bytes(std::span(std::get<ArgIndex>(args)));
             const size_t size = buffer.size();
 
             if (size > 0 && ctx.CanWriteBuffer(OutBufferIndex)) {
@@ -323,6 +323,7 @@ std::vector<u8> HLERequestContext::ReadBufferCopy(std::size_t buffer_index) cons
             "BufferDescriptorA invalid buffer_index {}", buffer_index);
         std::vector<u8> buffer(BufferDescriptorA()[buffer_index].Size());
         memory.ReadBlock(BufferDescriptorA()[buffer_index].Address(), buffer.data(), buffer.size());
+        copied_buffer_bytes += buffer.size();
         return buffer;
     } else {
         ASSERT_OR_EXECUTE_MSG(
@@ -330,33 +331,42 @@ std::vector<u8> HLERequestContext::ReadBufferCopy(std::size_t buffer_index) cons
             "BufferDescriptorX invalid buffer_index {}", buffer_index);
         std::vector<u8> buffer(BufferDescriptorX()[buffer_index].Size());
         memory.ReadBlock(BufferDescriptorX()[buffer_index].Address(), buffer.data(), buffer.size());
+        copied_buffer_bytes += buffer.size();
         return buffer;
     }
 }
 
-std::span<const u8> HLERequestContext::ReadBufferA(std::size_t buffer_index) const {
+std::span<const u8> HLERequestContext::ReadGuestBuffer(u64 address, std::size_t size,
+                                                       Common::ScratchBuffer<u8>& backup) const {
     Core::Memory::CpuGuestMemory<u8, Core::Memory::GuestMemoryFlags::UnsafeRead> gm(memory, 0, 0);
 
+    // Contiguous ranges are returned in place, the backup is only filled across discontiguities
+    const auto span = gm.Read(address, size, &backup);
+    if (!span.empty() && span.data() == backup.data()) {
+        copied_buffer_bytes += size;
+    }
+    return span;
+}
+
+std::span<const u8> HLERequestContext::ReadBufferA(std::size_t buffer_index) const {
     ASSERT_OR_EXECUTE_MSG(
         BufferDescriptorA().size() > buffer_index, { return {}; },
         "BufferDescriptorA invalid buffer_index {}", buffer_index);
-    return gm.Read(BufferDescriptorA()[buffer_index].Address(),
-                   BufferDescriptorA()[buffer_index].Size(), &read_buffer_data_a[buffer_index]);
+    return ReadGuestBuffer(BufferDescriptorA()[buffer_index].Address(),
+                           BufferDescriptorA()[buffer_index].Size(),
+                           read_buffer_data_a[buffer_index]);
 }
 
 std::span<const u8> HLERequestContext::ReadBufferX(std::size_t buffer_index) const {
-    Core::Memory::CpuGuestMemory<u8, Core::Memory::GuestMemoryFlags::UnsafeRead> gm(memory, 0, 0);
-
     ASSERT_OR_EXECUTE_MSG(
         BufferDescriptorX().size() > buffer_index, { return {}; },
         "BufferDescriptorX invalid buffer_index {}", buffer_index);
-    return gm.Read(BufferDescriptorX()[buffer_index].Address(),
-                   BufferDescriptorX()[buffer_index].Size(), &read_buffer_data_x[buffer_index]);
+    return ReadGuestBuffer(BufferDescriptorX()[buffer_index].Address(),
+                           BufferDescriptorX()[buffer_index].Size(),
+                           read_buffer_data_x[buffer_index]);
 }
 
 std::span<const u8> HLERequestContext::ReadBuffer(std::size_t buffer_index) const {
-    Core::Memory::CpuGuestMemory<u8, Core::Memory::GuestMemoryFlags::UnsafeRead> gm(memory, 0, 0);
-
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
                            BufferDescriptorA()[buffer_index].Size()};
     const bool is_buffer_x{BufferDescriptorX().size() > buffer_index &&
@@ -372,14 +382,16 @@ std::span<const u8> HLERequestContext::ReadBuffer(std::size_t buffer_index) cons
         ASSERT_OR_EXECUTE_MSG(
             BufferDescriptorA().size() > buffer_index, { return {}; },
             "BufferDescriptorA invalid buffer_index {}", buffer_index);
-        return gm.Read(BufferDescriptorA()[buffer_index].Address(),
-                       BufferDescriptorA()[buffer_index].Size(), &read_buffer_data_a[buffer_index]);
+        return ReadGuestBuffer(BufferDescriptorA()[buffer_index].Address(),
+                               BufferDescriptorA()[buffer_index].Size(),
+                               read_buffer_data_a[buffer_index]);
     } else {
         ASSERT_OR_EXECUTE_MSG(
             BufferDescriptorX().size() > buffer_index, { return {}; },
             "BufferDescriptorX invalid buffer_index {}", buffer_index);
-        return gm.Read(BufferDescriptorX()[buffer_index].Address(),
-                       BufferDescriptorX()[buffer_index].Size(), &read_buffer_data_x[buffer_index]);
+        return ReadGuestBuffer(BufferDescriptorX()[buffer_index].Address(),
+                               BufferDescriptorX()[buffer_index].Size(),
+                               read_buffer_data_x[buffer_index]);
     }
 }
 
@@ -429,7 +441,7 @@ std::size_t HLERequestContext::WriteBufferB(const void* buffer, std::size_t size
         size = buffer_size; // TODO(bunnei): This needs to be HW tested
     }
 
-    memory.WriteBlock(BufferDescriptorB()[buffer_index].Address(), buffer, size);
+    WriteGuestBuffer(BufferDescriptorB()[buffer_index].Address(), buffer, size);
     return size;
 }
 
@@ -446,10 +458,70 @@ std::size_t HLERequestContext::WriteBufferC(const void* buffer, std::size_t size
         size = buffer_size; // TODO(bunnei): This needs to be HW tested
     }
 
-    memory.WriteBlock(BufferDescriptorC()[buffer_index].Address(), buffer, size);
+    WriteGuestBuffer(BufferDescriptorC()[buffer_index].Address(), buffer, size);
     return size;
 }
 
+void HLERequestContext::WriteGuestBuffer(u64 address, const void* buffer,
+                                         std::size_t size) const {
+    if (buffer == memory.GetSpan(address, size)) {
+        // The buffer was mapped in place, the data is already in guest memory
+        memory.InvalidateRegion(address, size);
+        return;
+    }
+    memory.WriteBlock(address, buffer, size);
+    copied_buffer_bytes += size;
+}
+
+std::span<u8> HLERequestContext::MapGuestBuffer(u64 address, std::size_t size) const {
+    if (size == 0) {
+        return {};
+    }
+
+    // Services are free to read their inputs after writing to their outputs, so an output that
+    // aliases an input must keep going through a copy.
+    const auto overlaps = [&](const auto& descriptors) {
+        return std::ranges::any_of(descriptors, [&](const auto& descriptor) {
+            return descriptor.Size() != 0 && address < descriptor.Address() + descriptor.Size() &&
+                   descriptor.Address() < address + size;
+        });
+    };
+    if (overlaps(BufferDescriptorA()) || overlaps(BufferDescriptorX())) {
+        return {};
+    }
+
+    u8* const pointer = memory.GetSpan(address, size);
+    if (pointer == nullptr) {
+        return {};
+    }
+    return {pointer, size};
+}
+
+std::span<u8> HLERequestContext::GetWriteBufferSpanB(std::size_t buffer_index) const {
+    if (buffer_index >= BufferDescriptorB().size()) {
+        return {};
+    }
+    return MapGuestBuffer(BufferDescriptorB()[buffer_index].Address(),
+                          BufferDescriptorB()[buffer_index].Size());
+}
+
+std::span<u8> HLERequestContext::GetWriteBufferSpanC(std::size_t buffer_index) const {
+    if (buffer_index >= BufferDescriptorC().size()) {
+        return {};
+    }
+    return MapGuestBuffer(BufferDescriptorC()[buffer_index].Address(),
+                          BufferDescriptorC()[buffer_index].Size());
+}
+
+std::span<u8> HLERequestContext::GetWriteBufferSpan(std::size_t buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    if (is_buffer_b) {
+        return GetWriteBufferSpanB(buffer_index);
+    }
+    return GetWriteBufferSpanC(buffer_index);
+}
+
 std::size_t HLERequestContext::GetReadBufferSize(std::size_t buffer_index) const {
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
                            BufferDescriptorA()[buffer_index].Size()};
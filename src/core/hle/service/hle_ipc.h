@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -281,6 +282,20 @@ public:
     std::size_t WriteBufferC(const void* buffer, std::size_t size,
                              std::size_t buffer_index = 0) const;
 
+    /**
+     * Helper functions to map an output buffer in place. The returned span points directly to
+     * guest memory, and is empty when the buffer is not contiguous in host memory or overlaps an
+     * input buffer. Writing the span back with WriteBuffer only notifies the rasterizer.
+     */
+    [[nodiscard]] std::span<u8> GetWriteBufferSpanB(std::size_t buffer_index = 0) const;
+    [[nodiscard]] std::span<u8> GetWriteBufferSpanC(std::size_t buffer_index = 0) const;
+    [[nodiscard]] std::span<u8> GetWriteBufferSpan(std::size_t buffer_index = 0) const;
+
+    /// Returns the number of buffer bytes that had to be copied to or from guest memory
+    [[nodiscard]] u64 GetCopiedBufferBytes() const {
+        return copied_buffer_bytes;
+    }
+
     /* Helper function to write a buffer using the appropriate buffer descriptor
      *
      * @tparam T an arbitrary container that satisfies the
@@ -389,11 +404,34 @@ public:
         is_deferred = is_deferred_;
     }
 
+    /// Returns the host time at which the guest sent the request
+    [[nodiscard]] std::chrono::steady_clock::time_point GetRequestTime() const {
+        return request_time;
+    }
+
+    void SetRequestTime(std::chrono::steady_clock::time_point request_time_) {
+        request_time = request_time_;
+    }
+
+    /// Returns the host time spent in service handlers, including deferred attempts
+    [[nodiscard]] std::chrono::nanoseconds GetHandlerTime() const {
+        return handler_time;
+    }
+
+    void AddHandlerTime(std::chrono::nanoseconds time) {
+        handler_time += time;
+    }
+
 private:
     friend class IPC::ResponseBuilder;
 
     void ParseCommandBuffer(u32_le* src_cmdbuf, bool incoming);
 
+    std::span<const u8> ReadGuestBuffer(u64 address, std::size_t size,
+                                        Common::ScratchBuffer<u8>& backup) const;
+    std::span<u8> MapGuestBuffer(u64 address, std::size_t size) const;
+    void WriteGuestBuffer(u64 address, const void* buffer, std::size_t size) const;
+
     std::array<u32, IPC::COMMAND_BUFFER_LENGTH> cmd_buf;
     Kernel::KServerSession* server_session{};
     Kernel::KHandleTable* client_handle_table{};
@@ -425,12 +463,15 @@ private:
 
     std::weak_ptr<SessionRequestManager> manager{};
     bool is_deferred{false};
+    std::chrono::steady_clock::time_point request_time{};
+    std::chrono::nanoseconds handler_time{};
 
     Kernel::KernelCore& kernel;
     Core::Memory::Memory& memory;
 
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_a{};
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_x{};
+    mutable u64 copied_buffer_bytes{};
 };
 
 } // namespace Service
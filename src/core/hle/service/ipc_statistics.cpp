@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+
+#include <fmt/format.h>
+
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "core/hle/service/hle_ipc.h"
+#include "core/hle/service/ipc_statistics.h"
+
+namespace Service {
+namespace {
+size_t GetBucket(std::chrono::nanoseconds latency) {
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const size_t bucket = std::bit_width(static_cast<u64>(std::max<s64>(us, 0)));
+    return std::min(bucket, IpcStatistics::NumBuckets - 1);
+}
+
+u64 GetTransferredBytes(const HLERequestContext& ctx) {
+    u64 num_bytes = 0;
+    for (const auto& descriptor : ctx.BufferDescriptorA()) {
+        num_bytes += descriptor.Size();
+    }
+    for (const auto& descriptor : ctx.BufferDescriptorB()) {
+        num_bytes += descriptor.Size();
+    }
+    for (const auto& descriptor : ctx.BufferDescriptorX()) {
+        num_bytes += descriptor.Size();
+    }
+    for (const auto& descriptor : ctx.BufferDescriptorC()) {
+        num_bytes += descriptor.Size();
+    }
+    return num_bytes;
+}
+
+double ToMilliseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+double ToMicroseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::micro>(time).count();
+}
+} // Anonymous namespace
+
+std::chrono::microseconds IpcStatistics::Entry::Percentile(double percentile) const {
+    const auto threshold = static_cast<u64>(static_cast<double>(num_calls) * percentile);
+    u64 count = 0;
+    for (size_t bucket = 0; bucket < NumBuckets - 1; ++bucket) {
+        count += histogram[bucket];
+        if (count > threshold) {
+            return std::chrono::microseconds{u64{1} << bucket};
+        }
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(max_latency);
+}
+
+IpcStatistics::IpcStatistics() = default;
+
+IpcStatistics::~IpcStatistics() = default;
+
+void IpcStatistics::Start() {
+    {
+        std::scoped_lock lk{mutex};
+        services.clear();
+    }
+    is_running.store(true, std::memory_order_relaxed);
+}
+
+void IpcStatistics::Stop() {
+    is_running.store(false, std::memory_order_relaxed);
+}
+
+void IpcStatistics::Record(std::string_view service_name, const HLERequestContext& ctx) {
+    if (!IsRunning()) {
+        return;
+    }
+    const auto latency = std::chrono::steady_clock::now() - ctx.GetRequestTime();
+    const u32 command = ctx.GetCommand();
+    const u64 num_bytes = GetTransferredBytes(ctx);
+
+    std::scoped_lock lk{mutex};
+    auto service = services.find(service_name);
+    if (service == services.end()) {
+        service = services.emplace(std::string(service_name), std::map<u32, Entry>{}).first;
+    }
+    auto [it, is_new] = service->second.try_emplace(command);
+    Entry& entry = it->second;
+    if (is_new) {
+        entry.service_name = service->first;
+        entry.command = command;
+    }
+    ++entry.num_calls;
+    entry.num_bytes += num_bytes;
+    entry.total_latency += latency;
+    entry.max_latency = std::max<std::chrono::nanoseconds>(entry.max_latency, latency);
+    entry.handler_time += ctx.GetHandlerTime();
+    ++entry.histogram[GetBucket(latency)];
+}
+
+std::vector<IpcStatistics::Entry> IpcStatistics::GetEntries() const {
+    std::vector<Entry> result;
+    {
+        std::scoped_lock lk{mutex};
+        for (const auto& [name, commands] : services) {
+            for (const auto& [command, entry] : commands) {
+                result.push_back(entry);
+            }
+        }
+    }
+    std::ranges::sort(result, [](const Entry& lhs, const Entry& rhs) {
+        return lhs.total_latency > rhs.total_latency;
+    });
+    return result;
+}
+
+void IpcStatistics::WriteReport(const std::filesystem::path& path) const {
+    const auto entries = GetEntries();
+    if (entries.empty()) {
+        return;
+    }
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        LOG_ERROR(Service, "Failed to open IPC statistics {}", Common::FS::PathToUTF8String(path));
+        return;
+    }
+    file << fmt::format("{:<32} {:>8} {:>10} {:>12} {:>10} {:>10} {:>10} {:>10} {:>12} {:>14}\n",
+                        "service", "command", "calls", "total ms", "mean us", "p50 us", "p99 us",
+                        "max us", "handler ms", "bytes");
+    for (const auto& entry : entries) {
+        file << fmt::format(
+            "{:<32} {:>8} {:>10} {:>12.3f} {:>10.1f} {:>10} {:>10} {:>10.1f} {:>12.3f} {:>14}\n",
+            entry.service_name, entry.command, entry.num_calls, ToMilliseconds(entry.total_latency),
+            ToMicroseconds(entry.total_latency) / static_cast<double>(entry.num_calls),
+            entry.Percentile(0.5).count(), entry.Percentile(0.99).count(),
+            ToMicroseconds(entry.max_latency), ToMilliseconds(entry.handler_time),
+            entry.num_bytes);
+    }
+
+    // Latency histograms, bucket N counts the calls that took less than 2^N microseconds
+    file << "\nlatency histograms (us):\n";
+    for (const auto& entry : entries) {
+        file << fmt::format("{}:{}", entry.service_name, entry.command);
+        for (size_t bucket = 0; bucket < NumBuckets; ++bucket) {
+            if (entry.histogram[bucket] == 0) {
+                continue;
+            }
+            if (bucket == NumBuckets - 1) {
+                file << fmt::format(" >={}:{}", u64{1} << (bucket - 1), entry.histogram[bucket]);
+            } else {
+                file << fmt::format(" <{}:{}", u64{1} << bucket, entry.histogram[bucket]);
+            }
+        }
+        file << '\n';
+    }
+
+    LOG_INFO(Service, "Wrote IPC statistics of {} commands to {}", entries.size(),
+             Common::FS::PathToUTF8String(path));
+}
+
+} // namespace Service
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Service {
+
+class HLERequestContext;
+
+/**
+ * Per service and command statistics of HLE IPC requests.
+ *
+ * Latency is measured from the moment the guest sent the request to the moment the service
+ * replied, so it includes the time the request waited for its server thread and any deferral.
+ * Handler time only covers the host code of the service.
+ */
+class IpcStatistics {
+public:
+    /// Latencies are bucketed by powers of two microseconds, the last bucket collects the rest
+    static constexpr size_t NumBuckets = 20;
+
+    struct Entry {
+        std::string service_name;
+        u32 command{};
+        u64 num_calls{};
+        u64 num_bytes{};
+        std::chrono::nanoseconds total_latency{};
+        std::chrono::nanoseconds max_latency{};
+        std::chrono::nanoseconds handler_time{};
+        std::array<u64, NumBuckets> histogram{};
+
+        /// Returns the upper bound of the bucket containing the given percentile of calls
+        [[nodiscard]] std::chrono::microseconds Percentile(double percentile) const;
+    };
+
+    IpcStatistics();
+    ~IpcStatistics();
+
+    /// Clears the previous statistics and starts recording requests
+    void Start();
+
+    /// Stops recording, recorded statistics are kept until the next Start
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const {
+        return is_running.load(std::memory_order_relaxed);
+    }
+
+    /// Records a request the given service replied to
+    void Record(std::string_view service_name, const HLERequestContext& ctx);
+
+    /// Returns a snapshot of the statistics, sorted by decreasing total latency
+    [[nodiscard]] std::vector<Entry> GetEntries() const;
+
+    /// Writes a human readable report of the statistics
+    void WriteReport(const std::filesystem::path& path) const;
+
+private:
+    std::atomic_bool is_running{};
+
+    mutable std::mutex mutex;
+    std::map<std::string, std::map<u32, Entry>, std::less<>> services;
+};
+
+} // namespace Service
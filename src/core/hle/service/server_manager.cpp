@@ -1,7 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
+#include "common/logging/log.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
+#include "common/string_util.h"
 
 #include "core/core.h"
 #include "core/hle/kernel/k_client_port.h"
@@ -119,6 +124,7 @@ ServerManager::~ServerManager() {
 }
 
 void ServerManager::RunServer(std::unique_ptr<ServerManager>&& server_manager) {
+    server_manager->StartConfiguredHostThreads();
     server_manager->m_system.RunServer(std::move(server_manager));
 }
 
@@ -126,6 +132,7 @@ Result ServerManager::RegisterSession(Kernel::KServerSession* server_session,
                                       std::shared_ptr<SessionRequestManager> manager) {
     // We are taking ownership of the server session, so don't open it.
     auto* session = new Session(server_session, std::move(manager));
+    server_session->SetHle();
 
     // Begin tracking the server session.
     {
@@ -154,6 +161,7 @@ Result ServerManager::RegisterNamedService(const std::string& service_name,
     {
         std::scoped_lock ll{m_deferred_list_mutex};
         m_servers.push_back(*server);
+        m_service_names.push_back(service_name);
     }
 
     // Register to wait on the server port.
@@ -178,6 +186,7 @@ Result ServerManager::ManageNamedPort(const std::string& service_name,
     // Create a new port.
     auto* port = Kernel::KPort::Create(m_system.Kernel());
     port->Initialize(max_sessions, false, 0);
+    port->GetServerPort().SetHle();
 
     // Register the port.
     Kernel::KPort::Register(m_system.Kernel(), port);
@@ -202,6 +211,7 @@ Result ServerManager::ManageNamedPort(const std::string& service_name,
     {
         std::scoped_lock ll{m_deferred_list_mutex};
         m_servers.push_back(*server);
+        m_service_names.push_back(service_name);
     }
 
     // Register to wait on the port.
@@ -242,6 +252,28 @@ void ServerManager::StartAdditionalHostThreads(const char* name, size_t num_thre
     }
 }
 
+void ServerManager::StartConfiguredHostThreads() {
+    // Servers that already manage their own host threads keep them.
+    if (!m_threads.empty() || m_service_names.empty()) {
+        return;
+    }
+
+    std::vector<std::string> pooled_services;
+    Common::SplitString(Settings::values.pooled_services.GetValue(), ',', pooled_services);
+    const auto is_pooled = [&](const std::string& service_name) {
+        return std::ranges::find(pooled_services, service_name) != pooled_services.end();
+    };
+    if (std::ranges::none_of(m_service_names, is_pooled)) {
+        return;
+    }
+
+    // Each host thread waits for any signaled session, and a session is only waited on again
+    // once its reply was sent, so requests of one session remain serialized.
+    LOG_INFO(Service, "Running {} on a pool of {} host threads", m_service_names.front(),
+             NumPooledHostThreads);
+    this->StartAdditionalHostThreads(m_service_names.front().c_str(), NumPooledHostThreads - 1);
+}
+
 Result ServerManager::LoopProcess() {
     SCOPE_EXIT {
         m_stopped.Set();
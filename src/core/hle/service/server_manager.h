@@ -6,6 +6,7 @@
 #include <list>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "common/polyfill_thread.h"
@@ -53,6 +54,10 @@ public:
     static void RunServer(std::unique_ptr<ServerManager>&& server);
 
 private:
+    /// Number of host threads of servers running one of the services listed in pooled_services
+    static constexpr size_t NumPooledHostThreads = 4;
+
+    void StartConfiguredHostThreads();
     void LinkToDeferredList(MultiWaitHolder* holder);
     void LinkDeferred();
     MultiWaitHolder* WaitSignaled();
@@ -89,6 +94,7 @@ private:
     std::optional<MultiWaitHolder> m_deferral_holder{};
 
     // Host state tracking
+    std::vector<std::string> m_service_names{};
     Common::Event m_stopped{};
     std::vector<std::jthread> m_threads{};
     std::stop_source m_stop_source{};
@@ -9,6 +9,7 @@
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/service/ipc_helpers.h"
+#include "core/hle/service/ipc_statistics.h"
 #include "core/hle/service/service.h"
 #include "core/hle/service/sm/sm.h"
 #include "core/reporter.h"
@@ -92,6 +93,8 @@ void ServiceFrameworkBase::InvokeRequest(HLERequestContext& ctx) {
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
     handler_invoker(this, info->handler_callback, ctx);
+    LOG_TRACE(Service, "{}::{} copied {} buffer bytes", GetServiceName(), info->name,
+              ctx.GetCopiedBufferBytes());
 }
 
 void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
@@ -106,11 +109,14 @@ void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
     handler_invoker(this, info->handler_callback, ctx);
+    LOG_TRACE(Service, "{}::{} copied {} buffer bytes", GetServiceName(), info->name,
+              ctx.GetCopiedBufferBytes());
 }
 
 Result ServiceFrameworkBase::HandleSyncRequest(Kernel::KServerSession& session,
                                                HLERequestContext& ctx) {
     const auto guard = LockService();
+    const auto handler_start = std::chrono::steady_clock::now();
 
     Result result = ResultSuccess;
 
@@ -148,6 +154,11 @@ Result ServiceFrameworkBase::HandleSyncRequest(Kernel::KServerSession& session,
         ctx.WriteToOutgoingCommandBuffer();
     }
 
+    ctx.AddHandlerTime(std::chrono::steady_clock::now() - handler_start);
+    if (!ctx.GetIsDeferred()) {
+        system.GetIpcStatistics().Record(service_name, ctx);
+    }
+
     return result;
 }
 
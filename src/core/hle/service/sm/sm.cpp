@@ -62,6 +62,11 @@ Result ServiceManager::RegisterService(Kernel::KServerPort** out_server_port, st
     auto* port = Kernel::KPort::Create(kernel);
     port->Initialize(ServerSessionCountMax, false, 0);
 
+    // Services registered by the guest come without a handler
+    if (handler) {
+        port->GetServerPort().SetHle();
+    }
+
     // Register the port.
     Kernel::KPort::Register(kernel, port);
 
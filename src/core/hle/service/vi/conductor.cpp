@@ -88,8 +88,8 @@ void Conductor::VsyncThread(std::stop_token token) {
 s64 Conductor::GetNextTicks() const {
     const auto& settings = Settings::values;
     auto speed_scale = 1.f;
-    if (settings.use_multi_core.GetValue()) {
-        if (settings.use_speed_limit.GetValue()) {
+    if (Settings::IsMultiCoreEnabled()) {
+        if (Settings::IsSpeedLimitEnabled()) {
             // Scales the speed based on speed_limit setting on MC. SC is handled by
             // SpeedLimiter::DoSpeedLimiting.
             speed_scale = 100.f / settings.speed_limit.GetValue();
@@ -212,7 +212,7 @@ static bool LoadNroImpl(Core::System& system, Kernel::KProcess& process,
 
     if (Settings::IsNceEnabled()) {
         // Patch SVCs and MRS calls in the guest code
-        patch.PatchText(program_image, code);
+        patch.PatchText(program_image, code, Core::NCE::GetPatchSites(program_image, code));
 
         // We only support PostData patching for NROs.
         ASSERT(patch.GetPatchMode() == Core::NCE::PatchMode::PostData);
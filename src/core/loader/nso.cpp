@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "common/common_funcs.h"
+#include "common/fs/path_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/lz4_compression.h"
@@ -167,7 +168,10 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     auto* patch = patches ? &patches->operator[](patch_index) : nullptr;
     if (patch && !load_into_process) {
         // Patch SVCs and MRS calls in the guest code
-        while (!patch->PatchText(program_image, code)) {
+        const auto cache_path = Common::FS::GetYuzuPath(Common::FS::YuzuPath::CacheDir) / "nce" /
+                                fmt::format("{}.bin", Common::HexToString(nso_header.build_id));
+        const auto sites = Core::NCE::GetPatchSites(program_image, code, cache_path);
+        while (!patch->PatchText(program_image, code, sites)) {
             patch = &patches->emplace_back();
         }
     } else if (patch) {
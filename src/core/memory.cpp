@@ -64,6 +64,11 @@ struct Memory::Impl {
 #endif
     }
 
+    void SetCurrentPageTable(Common::PageTable& page_table) {
+        current_page_table = &page_table;
+        current_page_table->fastmem_arena = nullptr;
+    }
+
     void MapMemoryRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                          Common::PhysicalAddress target, Common::MemoryPermission perms,
                          bool separate_heap) {
@@ -128,7 +133,7 @@ struct Memory::Impl {
 
     [[nodiscard]] u8* GetPointerFromRasterizerCachedMemory(u64 vaddr) const {
         const Common::PhysicalAddress paddr{
-            current_page_table->backing_addr[vaddr >> YUZU_PAGEBITS]};
+            current_page_table->backing.GetBackingAddr(vaddr >> YUZU_PAGEBITS)};
 
         if (!paddr) {
             return {};
@@ -139,7 +144,7 @@ struct Memory::Impl {
 
     [[nodiscard]] u8* GetPointerFromDebugMemory(u64 vaddr) const {
         const Common::PhysicalAddress paddr{
-            current_page_table->backing_addr[vaddr >> YUZU_PAGEBITS]};
+            current_page_table->backing.GetBackingAddr(vaddr >> YUZU_PAGEBITS)};
 
         if (paddr == 0) {
             return {};
@@ -258,12 +263,37 @@ struct Memory::Impl {
         }
 
         while (remaining_size) {
-            const std::size_t copy_amount =
+            const auto [pointer, type] = page_table.pointers[page_index].PointerType();
+            const auto backing_addr = page_table.backing.GetBackingAddr(page_index);
+
+            // Extend the run over the following pages of the same type that are contiguous in
+            // host memory, so every run is copied at once. The rasterizer handlers still report
+            // the pages of a run one by one.
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(YUZU_PAGESIZE) - page_offset, remaining_size);
+            std::size_t num_pages = 1;
+            while (copy_amount < remaining_size) {
+                const std::size_t next_index = page_index + num_pages;
+                const auto [next_pointer, next_type] =
+                    page_table.pointers[next_index].PointerType();
+                if (next_type != type) {
+                    break;
+                }
+                if (type == Common::PageType::Memory && next_pointer != pointer) {
+                    break;
+                }
+                if ((type == Common::PageType::DebugMemory ||
+                     type == Common::PageType::RasterizerCachedMemory) &&
+                    page_table.backing.GetBackingAddr(next_index) != backing_addr) {
+                    break;
+                }
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(YUZU_PAGESIZE), remaining_size - copy_amount);
+                ++num_pages;
+            }
             const auto current_vaddr =
                 static_cast<u64>((page_index << YUZU_PAGEBITS) + page_offset);
 
-            const auto [pointer, type] = page_table.pointers[page_index].PointerType();
             switch (type) {
             case Common::PageType::Unmapped: {
                 user_accessible = false;
@@ -290,7 +320,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index += num_pages;
             page_offset = 0;
             increment(copy_amount);
             remaining_size -= copy_amount;
@@ -337,16 +367,16 @@ struct Memory::Impl {
     }
 
     const u8* GetSpan(const VAddr src_addr, const std::size_t size) const {
-        if (current_page_table->blocks[src_addr >> YUZU_PAGEBITS] ==
-            current_page_table->blocks[(src_addr + size) >> YUZU_PAGEBITS]) {
+        if (current_page_table->backing.GetBlock(src_addr >> YUZU_PAGEBITS) ==
+            current_page_table->backing.GetBlock((src_addr + size) >> YUZU_PAGEBITS)) {
             return GetPointerSilent(src_addr);
         }
         return nullptr;
     }
 
     u8* GetSpan(const VAddr src_addr, const std::size_t size) {
-        if (current_page_table->blocks[src_addr >> YUZU_PAGEBITS] ==
-            current_page_table->blocks[(src_addr + size) >> YUZU_PAGEBITS]) {
+        if (current_page_table->backing.GetBlock(src_addr >> YUZU_PAGEBITS) ==
+            current_page_table->backing.GetBlock((src_addr + size) >> YUZU_PAGEBITS)) {
             return GetPointerSilent(src_addr);
         }
         return nullptr;
@@ -408,6 +438,18 @@ struct Memory::Impl {
             [](const std::size_t copy_amount) {});
     }
 
+    void InvalidateRegion(const Common::ProcessAddress dest_addr, const std::size_t size) {
+        WalkBlock(
+            dest_addr, size,
+            [](const std::size_t copy_amount, const Common::ProcessAddress current_vaddr) {},
+            [](const std::size_t copy_amount, u8* const dest_ptr) {},
+            [&](const Common::ProcessAddress current_vaddr, const std::size_t copy_amount,
+                u8* const host_ptr) {
+                HandleRasterizerWrite(GetInteger(current_vaddr), copy_amount);
+            },
+            [](const std::size_t copy_amount) {});
+    }
+
     bool CopyBlock(Common::ProcessAddress dest_addr, Common::ProcessAddress src_addr,
                    const std::size_t size) {
         return WalkBlock(
@@ -647,22 +689,22 @@ struct Memory::Impl {
             ASSERT_MSG(type != Common::PageType::Memory,
                        "Mapping memory page without a pointer @ {:016x}", base * YUZU_PAGESIZE);
 
+            page_table.backing.Map(base, size, {});
             while (base != end) {
                 page_table.pointers[base].Store(0, type);
-                page_table.backing_addr[base] = 0;
-                page_table.blocks[base] = 0;
                 base += 1;
             }
         } else {
-            auto orig_base = base;
+            page_table.backing.Map(base, size,
+                                   {
+                                       .backing_addr = GetInteger(target) - (base << YUZU_PAGEBITS),
+                                       .block = base << YUZU_PAGEBITS,
+                                   });
             while (base != end) {
                 auto host_ptr =
                     reinterpret_cast<uintptr_t>(system.DeviceMemory().GetPointer<u8>(target)) -
                     (base << YUZU_PAGEBITS);
-                auto backing = GetInteger(target) - (base << YUZU_PAGEBITS);
                 page_table.pointers[base].Store(host_ptr, type);
-                page_table.backing_addr[base] = backing;
-                page_table.blocks[base] = orig_base << YUZU_PAGEBITS;
 
                 ASSERT_MSG(page_table.pointers[base].Pointer(),
                            "memory mapping base yield a nullptr within the table");
@@ -800,6 +842,22 @@ struct Memory::Impl {
         return true;
     }
 
+    /// Calls func with the offset and size of the part of the range within each page
+    static void ForEachPageChunk(VAddr v_address, size_t size, auto&& func) {
+        size_t offset = 0;
+        while (offset < size) {
+            const size_t page_offset = (v_address + offset) & YUZU_PAGEMASK;
+            const size_t chunk_size =
+                std::min(static_cast<size_t>(YUZU_PAGESIZE) - page_offset, size - offset);
+            func(offset, chunk_size);
+            offset += chunk_size;
+        }
+    }
+
+    // The rasterizer handlers accept ranges spanning several pages, as long as they are backed by
+    // contiguous host memory like the runs of WalkBlock. Each page may be mapped to different
+    // device addresses, so they are still reported page by page.
+
     void HandleRasterizerDownload(VAddr v_address, size_t size) {
         const auto* p = GetPointerImpl(
             v_address, []() {}, []() {});
@@ -808,13 +866,16 @@ struct Memory::Impl {
         }
         const size_t core = system.GetCurrentHostThreadID();
         auto& current_area = rasterizer_read_areas[core];
-        gpu_device_memory->ApplyOpOnPointer(p, scratch_buffers[core], [&](DAddr address) {
-            const DAddr end_address = address + size;
-            if (current_area.start_address <= address && end_address <= current_area.end_address)
-                [[likely]] {
-                return;
-            }
-            current_area = system.GPU().OnCPURead(address, size);
+        ForEachPageChunk(v_address, size, [&](size_t offset, size_t chunk_size) {
+            gpu_device_memory->ApplyOpOnPointer(
+                p + offset, scratch_buffers[core], [&](DAddr address) {
+                    const DAddr end_address = address + chunk_size;
+                    if (current_area.start_address <= address &&
+                        end_address <= current_area.end_address) [[likely]] {
+                        return;
+                    }
+                    current_area = system.GPU().OnCPURead(address, chunk_size);
+                });
         });
     }
 
@@ -836,18 +897,21 @@ struct Memory::Impl {
                 sys_core_guard.unlock();
             }
         };
-        gpu_device_memory->ApplyOpOnPointer(p, scratch_buffers[core], [&](DAddr address) {
-            auto& current_area = rasterizer_write_areas[core];
-            PAddr subaddress = address >> YUZU_PAGEBITS;
-            bool do_collection = current_area.last_address == subaddress;
-            if (!do_collection) [[unlikely]] {
-                do_collection = system.GPU().OnCPUWrite(address, size);
-                if (!do_collection) {
-                    return;
-                }
-                current_area.last_address = subaddress;
-            }
-            gpu_dirty_managers[core].Collect(address, size);
+        auto& current_area = rasterizer_write_areas[core];
+        ForEachPageChunk(v_address, size, [&](size_t offset, size_t chunk_size) {
+            gpu_device_memory->ApplyOpOnPointer(
+                p + offset, scratch_buffers[core], [&](DAddr address) {
+                    PAddr subaddress = address >> YUZU_PAGEBITS;
+                    bool do_collection = current_area.last_address == subaddress;
+                    if (!do_collection) [[unlikely]] {
+                        do_collection = system.GPU().OnCPUWrite(address, chunk_size);
+                        if (!do_collection) {
+                            return;
+                        }
+                        current_area.last_address = subaddress;
+                    }
+                    gpu_dirty_managers[core].Collect(address, chunk_size);
+                });
         });
     }
 
@@ -908,6 +972,10 @@ void Memory::SetCurrentPageTable(Kernel::KProcess& process) {
     impl->SetCurrentPageTable(process);
 }
 
+void Memory::SetCurrentPageTable(Common::PageTable& page_table) {
+    impl->SetCurrentPageTable(page_table);
+}
+
 void Memory::MapMemoryRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                              Common::PhysicalAddress target, Common::MemoryPermission perms,
                              bool separate_heap) {
@@ -1053,6 +1121,10 @@ bool Memory::ZeroBlock(Common::ProcessAddress dest_addr, const std::size_t size)
     return impl->ZeroBlock(dest_addr, size);
 }
 
+void Memory::InvalidateRegion(Common::ProcessAddress dest_addr, const std::size_t size) {
+    impl->InvalidateRegion(dest_addr, size);
+}
+
 void Memory::SetGPUDirtyManagers(std::span<Core::GPUDirtyMemoryManager> managers) {
     impl->gpu_dirty_managers = managers;
 }
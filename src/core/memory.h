@@ -435,6 +435,15 @@ public:
      */
     bool ZeroBlock(Common::ProcessAddress dest_addr, std::size_t size);
 
+    /**
+     * Notifies the rasterizer of a write to a range of the current process' address space that
+     * was done in place, through a pointer returned by GetSpan.
+     *
+     * @param dest_addr The virtual address the written range starts at.
+     * @param size      The size of the written range, in bytes.
+     */
+    void InvalidateRegion(Common::ProcessAddress dest_addr, std::size_t size);
+
     /**
      * Invalidates a range of bytes within the current process' address space at the specified
      * virtual address.
@@ -493,6 +502,10 @@ public:
     bool InvalidateSeparateHeap(void* fault_address);
 
 private:
+    // Test hook, lets the tests map guest memory without creating a process
+    friend class MemoryTestEnvironment;
+    void SetCurrentPageTable(Common::PageTable& page_table);
+
     Core::System& system;
 
     struct Impl;
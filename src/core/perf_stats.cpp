@@ -75,6 +75,19 @@ void PerfStats::EndSystemFrame() {
 
 void PerfStats::EndGameFrame() {
     game_frames.fetch_add(1, std::memory_order_relaxed);
+    total_game_frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerfStats::AddPresentTimings(const PresentTimings& timings) {
+    std::scoped_lock lock{object_mutex};
+
+    if (timings.gpu_done) {
+        accumulated_gpu_latency += *timings.gpu_done - timings.submit;
+        gpu_frames += 1;
+    }
+    accumulated_present_latency += timings.present - timings.submit;
+    present_frames += 1;
+    present_queue_depth = timings.queue_depth;
 }
 
 double PerfStats::GetMeanFrametime() const {
@@ -89,7 +102,8 @@ double PerfStats::GetMeanFrametime() const {
     return sum / static_cast<double>(current_index - IgnoreFrames);
 }
 
-PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us) {
+PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us,
+                                             const CpuIdleStats& cpu_idle) {
     std::scoped_lock lock{object_mutex};
 
     const auto now = Clock::now();
@@ -97,14 +111,32 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     const auto interval = duration_cast<DoubleSecs>(now - reset_point).count();
 
     const auto system_us_per_second = (current_system_time_us - reset_point_system_us) / interval;
+    const auto system_secs =
+        duration_cast<DoubleSecs>(current_system_time_us - reset_point_system_us).count();
+    const auto unparked_secs = interval * cpu_idle.num_threads -
+                               duration_cast<DoubleSecs>(cpu_idle.parked_time).count();
     const auto current_frames = static_cast<double>(game_frames.load(std::memory_order_relaxed));
     const auto current_fps = current_frames / interval;
+    const auto average_latency = [](Clock::duration accumulated, u32 num_frames) {
+        if (num_frames == 0) {
+            return 0.0;
+        }
+        return duration_cast<DoubleSecs>(accumulated).count() / static_cast<double>(num_frames);
+    };
     const PerfStatsResults results{
         .system_fps = static_cast<double>(system_frames) / interval,
         .average_game_fps = (current_fps + previous_fps) / 2.0,
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .gpu_latency = average_latency(accumulated_gpu_latency, gpu_frames),
+        .present_latency = average_latency(accumulated_present_latency, present_frames),
+        .present_queue_depth = present_queue_depth,
+        .unparked_time = system_secs > 0.0 ? unparked_secs / system_secs : 0.0,
+        .wake_latency = cpu_idle.num_wakeups != 0
+                            ? duration_cast<DoubleSecs>(cpu_idle.wake_latency).count() /
+                                  static_cast<double>(cpu_idle.num_wakeups)
+                            : 0.0,
     };
 
     // Reset counters
@@ -114,6 +146,10 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     system_frames = 0;
     game_frames.store(0, std::memory_order_relaxed);
     previous_fps = current_fps;
+    accumulated_gpu_latency = Clock::duration::zero();
+    accumulated_present_latency = Clock::duration::zero();
+    present_frames = 0;
+    gpu_frames = 0;
 
     return results;
 }
@@ -126,8 +162,7 @@ double PerfStats::GetLastFrameTimeScale() const {
 }
 
 void SpeedLimiter::DoSpeedLimiting(microseconds current_system_time_us) {
-    if (Settings::values.use_multi_core.GetValue() ||
-        !Settings::values.use_speed_limit.GetValue()) {
+    if (Settings::IsMultiCoreEnabled() || !Settings::IsSpeedLimitEnabled()) {
         return;
     }
 
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <optional>
 #include "common/common_types.h"
 
 namespace Core {
@@ -21,6 +22,43 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Average time between the CPU submitting a frame and the GPU finishing it, in seconds, zero
+    /// when the renderer did not measure GPU completion
+    double gpu_latency;
+    /// Average time between the CPU submitting a frame and its presentation, in seconds
+    double present_latency;
+    /// Number of frames the renderer allowed in flight when the last frame was presented
+    u32 present_queue_depth;
+    /// Seconds the host threads of the emulated cores spent unparked, per emulated second. This
+    /// includes time the threads were preempted by the host, and is zero in single core mode,
+    /// which never parks its thread
+    double unparked_time;
+    /// Average time between interrupting a parked core and the core resuming, in seconds
+    double wake_latency;
+};
+
+/// Parking statistics of the host threads running the emulated cores
+struct CpuIdleStats {
+    /// Number of host threads running the emulated cores that park when idle
+    u32 num_threads;
+    /// Total time the threads spent parked waiting for an interrupt
+    std::chrono::nanoseconds parked_time;
+    /// Number of times an interrupt woke a parked thread
+    u64 num_wakeups;
+    /// Total time between those interrupts and the threads resuming
+    std::chrono::nanoseconds wake_latency;
+};
+
+/// Timestamps of a single frame as measured by the renderer
+struct PresentTimings {
+    /// Point when the CPU finished recording the frame and submitted it
+    std::chrono::steady_clock::time_point submit;
+    /// Point when the GPU finished rendering the frame, empty when it was not measured
+    std::optional<std::chrono::steady_clock::time_point> gpu_done;
+    /// Point when the frame was queued for presentation
+    std::chrono::steady_clock::time_point present;
+    /// Number of frames the renderer allowed in flight
+    u32 queue_depth;
 };
 
 /**
@@ -38,7 +76,17 @@ public:
     void EndSystemFrame();
     void EndGameFrame();
 
-    PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
+    /// Records the latency of a frame presented by the renderer
+    void AddPresentTimings(const PresentTimings& timings);
+
+    /// Returns the number of game frames since the creation of this object
+    u64 GetTotalGameFrames() const {
+        return total_game_frames.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the statistics since the last reset, cpu_idle covers the same interval
+    PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us,
+                                      const CpuIdleStats& cpu_idle);
 
     /**
      * Returns the arithmetic mean of all frametime values stored in the performance history.
@@ -73,6 +121,8 @@ private:
     u32 system_frames = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     std::atomic<u32> game_frames = 0;
+    /// Cumulative number of game frames since creation, never reset
+    std::atomic<u64> total_game_frames = 0;
 
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
@@ -82,6 +132,17 @@ private:
     Clock::duration previous_frame_length = Clock::duration::zero();
     /// Previously computed fps
     double previous_fps = 0;
+
+    /// Cumulative submit to GPU completion latency of presented frames since last reset
+    Clock::duration accumulated_gpu_latency = Clock::duration::zero();
+    /// Cumulative submit to presentation latency of presented frames since last reset
+    Clock::duration accumulated_present_latency = Clock::duration::zero();
+    /// Cumulative number of frames presented by the renderer since last reset
+    u32 present_frames = 0;
+    /// Cumulative number of presented frames with a measured GPU completion since last reset
+    u32 gpu_frames = 0;
+    /// Frame queue depth reported with the last presented frame
+    u32 present_queue_depth = 0;
 };
 
 class SpeedLimiter {
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "core/replay_statistics.h"
+
+namespace Core {
+namespace {
+// Strips the number of a thread, so "CPUCore_0" and "CPUCore_1" are both counted as "CPUCore"
+std::string GetThreadGroup(std::string name) {
+    while (!name.empty() && (std::isdigit(static_cast<unsigned char>(name.back())) ||
+                             name.back() == '_' || name.back() == ' ' || name.back() == ':')) {
+        name.pop_back();
+    }
+    return name.empty() ? "unnamed" : name;
+}
+
+double ToSeconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double>(time).count();
+}
+} // Anonymous namespace
+
+ReplayStatistics::ReplayStatistics() = default;
+
+ReplayStatistics::~ReplayStatistics() = default;
+
+ReplayStatistics::CpuTimes ReplayStatistics::GetCpuTimes() {
+    CpuTimes result;
+    for (auto& thread : Common::GetThreadCpuTimes()) {
+        result[GetThreadGroup(std::move(thread.name))] += thread.cpu_time;
+    }
+    return result;
+}
+
+void ReplayStatistics::Start(std::chrono::nanoseconds emulated_time_) {
+    start_cpu_times = GetCpuTimes();
+    start_emulated_time = emulated_time_;
+    start_time = std::chrono::steady_clock::now();
+    is_running = true;
+}
+
+void ReplayStatistics::Stop(std::chrono::nanoseconds emulated_time_, u64 num_frames_) {
+    wall_time = std::chrono::steady_clock::now() - start_time;
+    emulated_time = emulated_time_ - start_emulated_time;
+    num_frames = num_frames_;
+
+    // Threads that exited during the replay are not counted, threads that started during it are
+    // counted from zero
+    cpu_times = GetCpuTimes();
+    for (auto& [name, cpu_time] : cpu_times) {
+        if (const auto it = start_cpu_times.find(name); it != start_cpu_times.end()) {
+            cpu_time -= std::min(cpu_time, it->second);
+        }
+    }
+    is_running = false;
+}
+
+std::string ReplayStatistics::GetReport() const {
+    const double wall_seconds = ToSeconds(wall_time);
+    std::string report;
+    report += fmt::format("{:<24} {:>12.3f} s\n", "wall time", wall_seconds);
+    report += fmt::format("{:<24} {:>12.3f} s\n", "emulated time", ToSeconds(emulated_time));
+    report += fmt::format("{:<24} {:>12}\n", "game frames", num_frames);
+    report += fmt::format("{:<24} {:>12.2f}\n", "frames per second",
+                          wall_seconds > 0.0 ? static_cast<double>(num_frames) / wall_seconds
+                                             : 0.0);
+    if (cpu_times.empty()) {
+        report += "\nhost cpu time per thread is not available on this platform\n";
+        return report;
+    }
+
+    std::vector<std::pair<std::string, std::chrono::nanoseconds>> sorted(cpu_times.begin(),
+                                                                         cpu_times.end());
+    std::ranges::sort(sorted, [](const auto& lhs, const auto& rhs) {
+        return lhs.second > rhs.second;
+    });
+    std::chrono::nanoseconds total_cpu_time{};
+    report += fmt::format("\n{:<24} {:>12} {:>12}\n", "thread", "cpu s", "cpu s/s");
+    for (const auto& [name, cpu_time] : sorted) {
+        if (cpu_time.count() == 0) {
+            continue;
+        }
+        total_cpu_time += cpu_time;
+        report += fmt::format("{:<24} {:>12.3f} {:>12.3f}\n", name, ToSeconds(cpu_time),
+                              wall_seconds > 0.0 ? ToSeconds(cpu_time) / wall_seconds : 0.0);
+    }
+    report += fmt::format("{:<24} {:>12.3f} {:>12.3f}\n", "total", ToSeconds(total_cpu_time),
+                          wall_seconds > 0.0 ? ToSeconds(total_cpu_time) / wall_seconds : 0.0);
+    return report;
+}
+
+void ReplayStatistics::WriteReport(const std::filesystem::path& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        LOG_ERROR(Core, "Failed to open replay report {}", Common::FS::PathToUTF8String(path));
+        return;
+    }
+    file << GetReport();
+
+    // Runs of the same replay must emulate the same frames in the same emulated time, compare
+    // these before comparing their timings
+    LOG_INFO(Core, "Replay of {} frames in {:.6f} emulated s took {:.3f} s, wrote the report to {}",
+             num_frames, ToSeconds(emulated_time), ToSeconds(wall_time),
+             Common::FS::PathToUTF8String(path));
+}
+
+} // namespace Core
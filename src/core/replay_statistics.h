@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <string>
+
+#include "common/common_types.h"
+
+namespace Core {
+
+/**
+ * Measurements of a deterministic replay.
+ *
+ * A replay runs the emulated cores on a single host thread in virtual time and feeds the game the
+ * same inputs, so the emulated time and number of frames reached do not change between runs. The
+ * host time and host CPU time a replay takes then measure the performance of the emulator.
+ */
+class ReplayStatistics {
+public:
+    ReplayStatistics();
+    ~ReplayStatistics();
+
+    /// Starts measuring, emulated_time is the current emulated time
+    void Start(std::chrono::nanoseconds emulated_time);
+
+    /// Stops measuring at the given emulated time, after num_frames game frames
+    void Stop(std::chrono::nanoseconds emulated_time, u64 num_frames);
+
+    [[nodiscard]] bool IsRunning() const {
+        return is_running;
+    }
+
+    /// Formats the wall time, frame rate and the host CPU time used per group of threads
+    [[nodiscard]] std::string GetReport() const;
+
+    /// Writes the report
+    void WriteReport(const std::filesystem::path& path) const;
+
+private:
+    /// Host CPU time per thread name, threads that only differ by their number are merged
+    using CpuTimes = std::map<std::string, std::chrono::nanoseconds>;
+
+    static CpuTimes GetCpuTimes();
+
+    bool is_running{};
+    std::chrono::steady_clock::time_point start_time{};
+    std::chrono::steady_clock::duration wall_time{};
+    std::chrono::nanoseconds start_emulated_time{};
+    std::chrono::nanoseconds emulated_time{};
+    u64 num_frames{};
+    CpuTimes start_cpu_times;
+    CpuTimes cpu_times;
+};
+
+} // namespace Core
@@ -318,6 +318,40 @@ void Tas::Reset() {
     needs_reset = true;
 }
 
+bool Tas::CanStartReplay() {
+    if (!Settings::values.tas_enable) {
+        LOG_ERROR(Input, "Replays play the TAS scripts, enable TAS to start one");
+        return false;
+    }
+    if (Settings::values.tas_loop) {
+        LOG_ERROR(Input, "Looping TAS scripts never finish, disable the loop to start a replay");
+        return false;
+    }
+    LoadTasFiles();
+    if (script_length == 0) {
+        LOG_ERROR(Input, "No TAS script to replay in {}",
+                  Common::FS::GetYuzuPathString(Common::FS::YuzuPath::TASDir));
+        return false;
+    }
+    replay_started = false;
+    return true;
+}
+
+bool Tas::UpdateReplay() {
+    if (!replay_started) {
+        // Every run of a replay gets the same inputs from its first frame on
+        replay_started = true;
+        Reset();
+        if (!is_running) {
+            StartStop();
+        }
+    }
+
+    const bool was_running = is_running;
+    UpdateThread();
+    return was_running && !is_running;
+}
+
 bool Tas::Record() {
     if (!Settings::values.tas_enable) {
         return true;
@@ -105,6 +105,19 @@ public:
     // Sets the flag to reload the file and start from the beginning in the next update
     void Reset();
 
+    /**
+     * Checks that a replay has TAS scripts to play, logs an error otherwise
+     * @returns true if the scripts are loaded and end without looping
+     */
+    bool CanStartReplay();
+
+    /**
+     * Plays the TAS scripts of a replay from the first call on, call it once per frame instead of
+     * UpdateThread
+     * @returns true on the frame the scripts finished, which ends the replay
+     */
+    bool UpdateReplay();
+
     /**
      * Sets the flag to enable or disable recording of inputs
      * @returns true if the current recording status is enabled
@@ -192,6 +205,7 @@ private:
     bool is_recording{false};
     bool is_running{false};
     bool needs_reset{false};
+    bool replay_started{false};
     std::array<std::vector<TASCommand>, PLAYER_NUMBER> commands{};
     std::vector<TASCommand> record_commands{};
     size_t current_command{0};
@@ -11,6 +11,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/common_types.h"
@@ -310,4 +311,24 @@ TEST_CASE("Fibers::Rewind", "[common]") {
     REQUIRE(test_control.rewinded);
 }
 
+TEST_CASE("Fibers::SwitchBenchmark", "[.][benchmark][common]") {
+    std::shared_ptr<Fiber> thread_fiber = Fiber::ThreadToFiber();
+    std::shared_ptr<Fiber> ping_fiber;
+    u64 num_pings = 0;
+    ping_fiber = std::make_shared<Fiber>([&] {
+        while (true) {
+            ++num_pings;
+            Fiber::YieldTo(ping_fiber, *thread_fiber);
+        }
+    });
+
+    // Each iteration is a round trip, two switches between fibers
+    BENCHMARK("Round trip") {
+        Fiber::YieldTo(thread_fiber, *ping_fiber);
+        return num_pings;
+    };
+
+    thread_fiber->Exit();
+}
+
 } // namespace Common
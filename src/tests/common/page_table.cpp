@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/page_table.h"
+
+namespace {
+
+constexpr std::size_t ADDRESS_SPACE_BITS = 32;
+constexpr std::size_t PAGE_BITS = 12;
+constexpr u64 PAGE_SIZE = 1ULL << PAGE_BITS;
+
+void MapRegion(Common::PageTable& page_table, u64 virt_addr, u64 phys_addr, u64 size) {
+    page_table.backing.Map(virt_addr >> PAGE_BITS, size >> PAGE_BITS,
+                           {.backing_addr = phys_addr - virt_addr, .block = virt_addr});
+}
+
+// Collects the physically contiguous ranges backing a virtual range, like
+// KPageTableBase::MakePageGroup
+std::vector<std::pair<u64, u64>> GetContiguousRanges(const Common::PageTable& page_table,
+                                                     u64 virt_addr, u64 size) {
+    std::vector<std::pair<u64, u64>> ranges;
+    Common::PageTable::TraversalContext context;
+    Common::PageTable::TraversalEntry entry;
+    if (!page_table.BeginTraversal(&entry, &context, virt_addr)) {
+        return ranges;
+    }
+    u64 cur_addr = entry.phys_addr;
+    u64 cur_size = entry.block_size - (cur_addr & (entry.block_size - 1));
+    u64 tot_size = cur_size;
+    while (tot_size < size) {
+        if (!page_table.ContinueTraversal(&entry, &context)) {
+            return {};
+        }
+        if (entry.phys_addr != cur_addr + cur_size) {
+            ranges.emplace_back(cur_addr, cur_size);
+            cur_addr = entry.phys_addr;
+            cur_size = entry.block_size;
+        } else {
+            cur_size += entry.block_size;
+        }
+        tot_size += entry.block_size;
+    }
+    if (tot_size > size) {
+        cur_size -= tot_size - size;
+    }
+    ranges.emplace_back(cur_addr, cur_size);
+    return ranges;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("PageTable[Traversal]", "[common]") {
+    Common::PageTable page_table;
+    page_table.Resize(ADDRESS_SPACE_BITS, PAGE_BITS);
+
+    MapRegion(page_table, 0x400000, 0x80000000, 0x400000);
+    MapRegion(page_table, 0x800000, 0x90000000, 0x3000);
+    MapRegion(page_table, 0x803000, 0x80400000, 0x1000);
+
+    // Contiguous memory is reported in aligned blocks, which grow as the traversal goes on
+    Common::PageTable::TraversalContext context;
+    Common::PageTable::TraversalEntry entry;
+    REQUIRE(page_table.BeginTraversal(&entry, &context, 0x400000));
+    REQUIRE(entry.phys_addr == 0x80000000);
+    REQUIRE(entry.block_size == 0x1000);
+    u64 expected_addr = 0x80001000;
+    for (const u64 block_size : {0x1000, 0x2000, 0x4000, 0x8000, 0x10000, 0x20000, 0x40000,
+                                 0x80000, 0x100000, 0x200000}) {
+        REQUIRE(page_table.ContinueTraversal(&entry, &context));
+        REQUIRE(entry.phys_addr == expected_addr);
+        REQUIRE(entry.block_size == block_size);
+        expected_addr += block_size;
+    }
+    REQUIRE(expected_addr == 0x80400000);
+
+    // Blocks never extend over a discontinuity
+    REQUIRE(page_table.ContinueTraversal(&entry, &context));
+    REQUIRE(entry.phys_addr == 0x90000000);
+    REQUIRE(entry.block_size == 0x2000);
+    REQUIRE(page_table.ContinueTraversal(&entry, &context));
+    REQUIRE(entry.phys_addr == 0x90002000);
+    REQUIRE(entry.block_size == 0x1000);
+    REQUIRE(page_table.ContinueTraversal(&entry, &context));
+    REQUIRE(entry.phys_addr == 0x80400000);
+    REQUIRE(page_table.ContinueTraversal(&entry, &context) == false);
+
+    // Traversals starting in the middle of a page report the containing page
+    REQUIRE(page_table.BeginTraversal(&entry, &context, 0x5FF800));
+    REQUIRE(entry.phys_addr == 0x801FF800);
+    REQUIRE(entry.block_size == 0x1000);
+
+    REQUIRE(GetContiguousRanges(page_table, 0x401000, 0x402000) ==
+            std::vector<std::pair<u64, u64>>{{0x80001000, 0x3FF000}, {0x90000000, 0x3000}});
+    REQUIRE(GetContiguousRanges(page_table, 0x802000, 0x2000) ==
+            std::vector<std::pair<u64, u64>>{{0x90002000, 0x1000}, {0x80400000, 0x1000}});
+    REQUIRE(GetContiguousRanges(page_table, 0x803000, 0x2000).empty());
+}
+
+TEST_CASE("PageTable[Backing]", "[common]") {
+    Common::PageTable page_table;
+    page_table.Resize(ADDRESS_SPACE_BITS, PAGE_BITS);
+    const auto& backing = page_table.backing;
+
+    // Regions covered by a single mapping are stored as blocks
+    MapRegion(page_table, 0x200000, 0x80000000, 0x400000);
+    REQUIRE(backing.GetBackingAddr(0x200) == 0x80000000 - 0x200000);
+    REQUIRE(backing.GetBackingAddr(0x5FF) == 0x80000000 - 0x200000);
+    REQUIRE(backing.GetBlock(0x3FF) == 0x200000);
+    REQUIRE(backing.GetBackingAddr(0x600) == 0);
+    REQUIRE(backing.HasBackingAddr(0x400, 0x200, 0x80000000 - 0x200000));
+
+    // Mapping part of a block splits it, the rest of the block keeps its entry
+    MapRegion(page_table, 0x300000, 0x90000000, 0x2000);
+    REQUIRE(backing.GetBackingAddr(0x2FF) == 0x80000000 - 0x200000);
+    REQUIRE(backing.GetBackingAddr(0x300) == 0x90000000 - 0x300000);
+    REQUIRE(backing.GetBackingAddr(0x301) == 0x90000000 - 0x300000);
+    REQUIRE(backing.GetBlock(0x301) == 0x300000);
+    REQUIRE(backing.GetBackingAddr(0x302) == 0x80000000 - 0x200000);
+    REQUIRE(backing.GetBlock(0x302) == 0x200000);
+    REQUIRE(backing.HasBackingAddr(0x200, 0x100, 0x80000000 - 0x200000));
+    REQUIRE(!backing.HasBackingAddr(0x200, 0x101, 0x80000000 - 0x200000));
+
+    // Mapping a range that crosses regions only splits the partially covered ones
+    MapRegion(page_table, 0x1FF000, 0xA0000000, 0x202000);
+    REQUIRE(backing.GetBackingAddr(0x1FF) == 0xA0000000 - 0x1FF000);
+    REQUIRE(backing.GetBackingAddr(0x300) == 0xA0000000 - 0x1FF000);
+    REQUIRE(backing.GetBackingAddr(0x400) == 0xA0000000 - 0x1FF000);
+    REQUIRE(backing.GetBackingAddr(0x401) == 0x80000000 - 0x200000);
+
+    // Unmapping everything turns the split regions back into blocks
+    page_table.backing.Map(0, backing.size(), {});
+    for (const u64 page : {0x1FF, 0x200, 0x300, 0x401, 0x5FF}) {
+        REQUIRE(backing.GetBackingAddr(page) == 0);
+        REQUIRE(backing.GetBlock(page) == 0);
+    }
+}
+
+TEST_CASE("PageTable[Benchmark]", "[.][benchmark][common]") {
+    Common::PageTable page_table;
+    page_table.Resize(ADDRESS_SPACE_BITS, PAGE_BITS);
+    MapRegion(page_table, 0x10000000, 0x80000000, 0x1000000);
+
+    BENCHMARK("Traverse 4 KiB") {
+        return GetContiguousRanges(page_table, 0x10400000, 0x1000).size();
+    };
+    BENCHMARK("Traverse 64 KiB") {
+        return GetContiguousRanges(page_table, 0x10400000, 0x10000).size();
+    };
+    BENCHMARK("Traverse 16 MiB") {
+        return GetContiguousRanges(page_table, 0x10000000, 0x1000000).size();
+    };
+
+    // Lookups of pages in a block and in a split region
+    MapRegion(page_table, 0x10800000, 0x90000000, 0x1000);
+    BENCHMARK("Lookup 4096 pages") {
+        u64 result = 0;
+        for (u64 page = 0x10000; page < 0x11000; ++page) {
+            result += page_table.backing.GetBackingAddr(page);
+        }
+        return result;
+    };
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/arm/exclusive_monitor.h"
+#include "tests/core/memory_test_environment.h"
+
+namespace {
+
+constexpr std::size_t NUM_CORES = 4;
+constexpr u32 NUM_ITERATIONS = 10'000;
+
+constexpr VAddr BASE = 0x10000;
+constexpr VAddr ADDR32 = BASE;
+constexpr VAddr ADDR64 = BASE + 0x40;
+constexpr VAddr ADDR128 = BASE + 0x80;
+
+// One guest page, accessed through the exclusive monitor of the JIT
+struct TestEnvironment : Core::Memory::MemoryTestEnvironment {
+    TestEnvironment() : MemoryTestEnvironment{BASE, Core::Memory::YUZU_PAGESIZE} {
+        monitor = Core::MakeExclusiveMonitor(memory, NUM_CORES);
+    }
+
+    std::unique_ptr<Core::ExclusiveMonitor> monitor;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("ExclusiveMonitor[Reservations]", "[core]") {
+    TestEnvironment env;
+    auto* const monitor = env.monitor.get();
+    if (monitor == nullptr) {
+        // No exclusive monitor on this host architecture
+        return;
+    }
+    auto& memory = env.memory;
+
+    // A write succeeds once after a read, the reservation is consumed by it
+    REQUIRE(monitor->ExclusiveRead32(0, ADDR32) == 0);
+    REQUIRE(monitor->ExclusiveWrite32(0, ADDR32, 1));
+    REQUIRE(!monitor->ExclusiveWrite32(0, ADDR32, 2));
+    REQUIRE(memory.Read32(ADDR32) == 1);
+
+    // A successful write from another core breaks the reservation
+    REQUIRE(monitor->ExclusiveRead32(0, ADDR32) == 1);
+    REQUIRE(monitor->ExclusiveRead32(1, ADDR32) == 1);
+    REQUIRE(monitor->ExclusiveWrite32(1, ADDR32, 3));
+    REQUIRE(!monitor->ExclusiveWrite32(0, ADDR32, 4));
+    REQUIRE(memory.Read32(ADDR32) == 3);
+
+    // Clearing drops the reservation
+    REQUIRE(monitor->ExclusiveRead64(2, ADDR64) == 0);
+    monitor->ClearExclusive(2);
+    REQUIRE(!monitor->ExclusiveWrite64(2, ADDR64, 5));
+    REQUIRE(memory.Read64(ADDR64) == 0);
+
+    // A plain store to the reserved address makes the write fail
+    REQUIRE(monitor->ExclusiveRead64(3, ADDR64) == 0);
+    memory.Write64(ADDR64, 6);
+    REQUIRE(!monitor->ExclusiveWrite64(3, ADDR64, 7));
+    REQUIRE(memory.Read64(ADDR64) == 6);
+
+    // Both halves of a 128-bit value are written together
+    const u128 value{8, 9};
+    REQUIRE(monitor->ExclusiveRead128(0, ADDR128) == u128{});
+    REQUIRE(monitor->ExclusiveWrite128(0, ADDR128, value));
+    REQUIRE(memory.Read64(ADDR128) == value[0]);
+    REQUIRE(memory.Read64(ADDR128 + 8) == value[1]);
+}
+
+TEST_CASE("ExclusiveMonitor[Stress]", "[core]") {
+    TestEnvironment env;
+    auto* const monitor = env.monitor.get();
+    if (monitor == nullptr) {
+        return;
+    }
+
+    // Every core increments the counters with exclusive load/store loops, as guest atomics do
+    const auto run = [monitor](std::size_t core) {
+        for (u32 i = 0; i < NUM_ITERATIONS; ++i) {
+            while (!monitor->ExclusiveWrite32(core, ADDR32,
+                                              monitor->ExclusiveRead32(core, ADDR32) + 1)) {
+            }
+            while (!monitor->ExclusiveWrite64(core, ADDR64,
+                                              monitor->ExclusiveRead64(core, ADDR64) + 1)) {
+            }
+            while (true) {
+                const u128 value = monitor->ExclusiveRead128(core, ADDR128);
+                // Carry into the upper half, both halves are written by one operation
+                const u128 incremented{value[0] + 1, value[1] + (value[0] + 1 == 0 ? 1 : 0)};
+                if (monitor->ExclusiveWrite128(core, ADDR128, incremented)) {
+                    break;
+                }
+            }
+        }
+    };
+
+    std::vector<std::jthread> threads;
+    for (std::size_t core = 0; core < NUM_CORES; ++core) {
+        threads.emplace_back(run, core);
+    }
+    threads.clear();
+
+    constexpr u64 expected = NUM_CORES * NUM_ITERATIONS;
+    REQUIRE(env.memory.Read32(ADDR32) == expected);
+    REQUIRE(env.memory.Read64(ADDR64) == expected);
+    REQUIRE(env.memory.Read64(ADDR128) == expected);
+    REQUIRE(env.memory.Read64(ADDR128 + 8) == 0);
+}
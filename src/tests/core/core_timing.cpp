@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2016 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
@@ -10,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -40,6 +42,25 @@ struct ScopeInit final {
     Core::Timing::CoreTiming core_timing;
 };
 
+// Single core timing only moves when ticks are added, which makes event times deterministic
+struct SingleCoreInit final {
+    SingleCoreInit() {
+        core_timing.SetMulticore(false);
+        core_timing.Initialize([]() {});
+    }
+
+    Core::Timing::CoreTiming core_timing;
+};
+
+// Runs the cores until the given time and processes the events that are due
+std::optional<s64> AdvanceTo(Core::Timing::CoreTiming& core_timing,
+                             std::chrono::nanoseconds time) {
+    while (core_timing.GetGlobalTimeNs() < time) {
+        core_timing.AddTicks(1000U);
+    }
+    return core_timing.Advance();
+}
+
 u64 TestTimerSpeed(Core::Timing::CoreTiming& core_timing) {
     const u64 start = core_timing.GetGlobalTimeNs().count();
     volatile u64 placebo = 0;
@@ -139,3 +160,131 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[Unschedule]", "[core]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+    u32 num_calls = 0;
+    const auto event = Core::Timing::CreateEvent(
+        "event",
+        [&num_calls](s64, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+            ++num_calls;
+            return std::nullopt;
+        });
+
+    const auto start = core_timing.GetGlobalTimeNs();
+    core_timing.ScheduleEvent(std::chrono::microseconds{10}, event);
+    core_timing.UnscheduleEvent(event);
+
+    REQUIRE(!AdvanceTo(core_timing, start + std::chrono::microseconds{20}));
+    REQUIRE(num_calls == 0);
+}
+
+TEST_CASE("CoreTiming[UnscheduleFromCallback]", "[core]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+    u32 num_calls = 0;
+    std::shared_ptr<Core::Timing::EventType> event;
+    event = Core::Timing::CreateEvent(
+        "looping", [&](s64, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+            ++num_calls;
+            // Advance holds the lock an unschedule waits for, so it must not wait here
+            core_timing.UnscheduleEvent(event, Core::Timing::UnscheduleEventType::NoWait);
+            return std::nullopt;
+        });
+
+    const auto start = core_timing.GetGlobalTimeNs();
+    core_timing.ScheduleLoopingEvent(std::chrono::microseconds{10}, std::chrono::microseconds{10},
+                                     event);
+
+    // The looping event is not rescheduled after unscheduling itself
+    REQUIRE(!AdvanceTo(core_timing, start + std::chrono::microseconds{15}));
+    REQUIRE(num_calls == 1);
+    REQUIRE(!AdvanceTo(core_timing, start + std::chrono::microseconds{50}));
+    REQUIRE(num_calls == 1);
+}
+
+TEST_CASE("CoreTiming[RescheduleAfterUnschedule]", "[core]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+    std::vector<s64> call_times;
+    const auto callback = [&call_times](s64 time, std::chrono::nanoseconds)
+        -> std::optional<std::chrono::nanoseconds> {
+        call_times.push_back(time);
+        return std::nullopt;
+    };
+    const auto event = Core::Timing::CreateEvent("event", callback);
+
+    const auto start = core_timing.GetGlobalTimeNs();
+    core_timing.ScheduleEvent(std::chrono::microseconds{10}, event);
+    core_timing.UnscheduleEvent(event);
+    core_timing.ScheduleEvent(std::chrono::microseconds{20}, event);
+
+    // Only the cancelled instance was due, the new one still is pending
+    const auto next_time = AdvanceTo(core_timing, start + std::chrono::microseconds{15});
+    REQUIRE(call_times.empty());
+    REQUIRE(next_time == (start + std::chrono::microseconds{20}).count());
+
+    REQUIRE(!AdvanceTo(core_timing, start + std::chrono::microseconds{25}));
+    REQUIRE(call_times.size() == 1);
+    REQUIRE(call_times[0] == (start + std::chrono::microseconds{20}).count());
+}
+
+TEST_CASE("CoreTiming[AdvanceSkipsCancelled]", "[core]") {
+    SingleCoreInit guard;
+    auto& core_timing = guard.core_timing;
+    const auto callback = [](s64, std::chrono::nanoseconds)
+        -> std::optional<std::chrono::nanoseconds> { return std::nullopt; };
+    const auto cancelled_event = Core::Timing::CreateEvent("cancelled", callback);
+    const auto pending_event = Core::Timing::CreateEvent("pending", callback);
+
+    const auto start = core_timing.GetGlobalTimeNs();
+    core_timing.ScheduleEvent(std::chrono::microseconds{10}, cancelled_event);
+    core_timing.ScheduleEvent(std::chrono::microseconds{50}, pending_event);
+    core_timing.UnscheduleEvent(cancelled_event);
+
+    // The next wake up is the pending event, not the cancelled one on top of the queue
+    REQUIRE(core_timing.Advance() == (start + std::chrono::microseconds{50}).count());
+    core_timing.UnscheduleEvent(pending_event);
+    REQUIRE(!core_timing.Advance());
+}
+
+TEST_CASE("CoreTiming[Benchmark]", "[.][benchmark][core]") {
+    // Single core timing is advanced manually, so only the event queue is measured
+    Core::Timing::CoreTiming core_timing;
+    core_timing.SetMulticore(false);
+    core_timing.Initialize([]() {});
+
+    constexpr size_t num_looping_events = 256;
+    u64 num_callbacks = 0;
+    const auto callback = [&num_callbacks](s64, std::chrono::nanoseconds)
+        -> std::optional<std::chrono::nanoseconds> {
+        ++num_callbacks;
+        return std::nullopt;
+    };
+
+    // Looping events with periods between 100us and 1ms, like the audio, input and vsync events
+    std::vector<std::shared_ptr<Core::Timing::EventType>> looping_events;
+    for (size_t i = 0; i < num_looping_events; ++i) {
+        const std::chrono::nanoseconds period{100'000 + static_cast<s64>(i) * 3'500};
+        looping_events.push_back(Core::Timing::CreateEvent("looping", callback));
+        core_timing.ScheduleLoopingEvent(period, period, looping_events.back());
+    }
+    const auto timeout_event = Core::Timing::CreateEvent("timeout", callback);
+
+    BENCHMARK("Schedule and unschedule") {
+        core_timing.ScheduleEvent(std::chrono::milliseconds{5}, timeout_event);
+        core_timing.UnscheduleEvent(timeout_event);
+        return num_callbacks;
+    };
+
+    BENCHMARK("Advance") {
+        core_timing.Idle();
+        return core_timing.Advance();
+    };
+
+    for (const auto& event : looping_events) {
+        core_timing.UnscheduleEvent(event);
+    }
+    REQUIRE(num_callbacks > 0);
+}
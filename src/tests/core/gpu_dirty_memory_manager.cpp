@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/gpu_dirty_memory_manager.h"
+
+namespace {
+
+using Range = std::pair<PAddr, size_t>;
+
+std::vector<Range> GatherRanges(Core::GPUDirtyMemoryManager& manager) {
+    std::vector<Range> ranges;
+    std::function<void(PAddr, size_t)> callback = [&ranges](PAddr address, size_t size) {
+        ranges.emplace_back(address, size);
+    };
+    manager.Gather(callback);
+    return ranges;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("GPUDirtyMemoryManager[Coalescing]", "[core]") {
+    Core::GPUDirtyMemoryManager manager;
+
+    // Writes within a page are merged into contiguous ranges of 64 bytes
+    manager.Collect(0x10000, 0x10);
+    manager.Collect(0x10040, 0x40);
+    manager.Collect(0x10100, 0x80);
+    REQUIRE(GatherRanges(manager) == std::vector<Range>{{0x10000, 0x80}, {0x10100, 0x80}});
+    REQUIRE(GatherRanges(manager).empty());
+
+    // Writes spanning several pages mark all of them
+    manager.Collect(0x20400, 0x1000);
+    REQUIRE(GatherRanges(manager) == std::vector<Range>{{0x20400, 0x400}, {0x20800, 0x800},
+                                                        {0x21000, 0x400}});
+
+    // Pages are reported in the order they were first written
+    manager.Collect(0x30000, 0x40);
+    manager.Collect(0x40000, 0x40);
+    manager.Collect(0x30000, 0x40);
+    REQUIRE(GatherRanges(manager) ==
+            std::vector<Range>{{0x30000, 0x40}, {0x40000, 0x40}, {0x30000, 0x40}});
+}
+
+TEST_CASE("GPUDirtyMemoryManager[Benchmark]", "[.][benchmark][core]") {
+    constexpr size_t max_cores = 4;
+    constexpr size_t writes_per_core = 1 << 16;
+
+    std::array<Core::GPUDirtyMemoryManager, max_cores> managers;
+    std::function<void(PAddr, size_t)> callback = [](PAddr, size_t) {};
+
+    // Every core streams small writes through its own region, while the GPU thread gathers
+    for (size_t num_cores = 1; num_cores <= max_cores; ++num_cores) {
+        BENCHMARK(std::to_string(num_cores) + " cores") {
+            std::atomic<size_t> num_running{num_cores};
+            std::vector<std::jthread> cores;
+            for (size_t core = 0; core < num_cores; ++core) {
+                cores.emplace_back([&, core] {
+                    const PAddr base = (core + 1) << 32;
+                    for (size_t i = 0; i < writes_per_core; ++i) {
+                        managers[core].Collect(base + i * 0x100, 0x40);
+                    }
+                    --num_running;
+                });
+            }
+            while (num_running != 0) {
+                for (size_t core = 0; core < num_cores; ++core) {
+                    managers[core].Gather(callback);
+                }
+            }
+            cores.clear();
+            for (size_t core = 0; core < num_cores; ++core) {
+                managers[core].Gather(callback);
+            }
+            return num_cores * writes_per_core;
+        };
+    }
+}
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/hle/kernel/k_affinity_mask.h"
+#include "core/hle/kernel/k_priority_queue.h"
+
+namespace {
+
+constexpr size_t NUM_CORES = 4;
+constexpr s32 LOWEST_PRIORITY = 63;
+constexpr s32 HIGHEST_PRIORITY = 0;
+
+// Minimal stand-in for KThread with the members the priority queue requires
+class TestThread {
+public:
+    class QueueEntry {
+    public:
+        constexpr void Initialize() {
+            m_prev = nullptr;
+            m_next = nullptr;
+        }
+
+        constexpr TestThread* GetPrev() const {
+            return m_prev;
+        }
+        constexpr TestThread* GetNext() const {
+            return m_next;
+        }
+        constexpr void SetPrev(TestThread* thread) {
+            m_prev = thread;
+        }
+        constexpr void SetNext(TestThread* thread) {
+            m_next = thread;
+        }
+
+    private:
+        TestThread* m_prev{};
+        TestThread* m_next{};
+    };
+
+    TestThread(s32 priority, s32 active_core, u64 affinity)
+        : m_priority{priority}, m_active_core{active_core} {
+        m_affinity.SetAffinityMask(affinity);
+    }
+
+    QueueEntry& GetPriorityQueueEntry(s32 core) {
+        return m_entries[core];
+    }
+    const QueueEntry& GetPriorityQueueEntry(s32 core) const {
+        return m_entries[core];
+    }
+
+    const Kernel::KAffinityMask& GetAffinityMask() const {
+        return m_affinity;
+    }
+    s32 GetActiveCore() const {
+        return m_active_core;
+    }
+    void SetActiveCore(s32 core) {
+        m_active_core = core;
+    }
+    s32 GetPriority() const {
+        return m_priority;
+    }
+    void SetPriority(s32 priority) {
+        m_priority = priority;
+    }
+    bool IsDummyThread() const {
+        return false;
+    }
+
+private:
+    std::array<QueueEntry, NUM_CORES> m_entries{};
+    Kernel::KAffinityMask m_affinity{};
+    s32 m_priority{};
+    s32 m_active_core{};
+};
+
+using TestQueue = Kernel::KPriorityQueue<TestThread, NUM_CORES, LOWEST_PRIORITY, HIGHEST_PRIORITY>;
+
+} // Anonymous namespace
+
+TEST_CASE("KPriorityQueue[Ordering]", "[kernel]") {
+    TestQueue queue;
+    TestThread low{40, 0, 0b0011};
+    TestThread high{10, 0, 0b0001};
+    TestThread same{40, 0, 0b0001};
+    TestThread other{20, 1, 0b0110};
+
+    queue.PushBack(&low);
+    queue.PushBack(&high);
+    queue.PushBack(&same);
+    queue.PushBack(&other);
+
+    // Scheduled queues are ordered by priority, then by insertion order
+    REQUIRE(queue.GetScheduledFront(0) == &high);
+    REQUIRE(queue.GetScheduledNext(0, &high) == &low);
+    REQUIRE(queue.GetScheduledNext(0, &low) == &same);
+    REQUIRE(queue.GetScheduledNext(0, &same) == nullptr);
+    REQUIRE(queue.GetScheduledFront(1) == &other);
+    REQUIRE(queue.GetScheduledFront(2) == nullptr);
+
+    // Threads are suggested for the other cores of their affinity mask
+    REQUIRE(queue.GetSuggestedFront(1) == &low);
+    REQUIRE(queue.GetSuggestedFront(2) == &other);
+    REQUIRE(queue.GetSuggestedFront(3) == nullptr);
+    REQUIRE(queue.GetSuggestedCores() == 0b0110);
+
+    // Migrating a thread moves it from the suggested to the scheduled queue of its new core
+    low.SetActiveCore(1);
+    queue.ChangeCore(0, &low);
+    REQUIRE(queue.GetScheduledFront(1) == &other);
+    REQUIRE(queue.GetScheduledNext(1, &other) == &low);
+    REQUIRE(queue.GetSuggestedFront(0) == &low);
+    REQUIRE(queue.GetSuggestedFront(1) == nullptr);
+    REQUIRE(queue.GetSuggestedCores() == 0b0101);
+
+    // Raising the priority of a running thread keeps it in front
+    const s32 prev_priority = low.GetPriority();
+    low.SetPriority(5);
+    queue.ChangePriority(prev_priority, true, &low);
+    REQUIRE(queue.GetScheduledFront(1) == &low);
+
+    queue.Remove(&low);
+    queue.Remove(&high);
+    queue.Remove(&same);
+    queue.Remove(&other);
+    for (s32 core = 0; core < static_cast<s32>(NUM_CORES); ++core) {
+        REQUIRE(queue.GetScheduledFront(core) == nullptr);
+        REQUIRE(queue.GetSuggestedFront(core) == nullptr);
+    }
+    REQUIRE(queue.GetSuggestedCores() == 0);
+}
+
+TEST_CASE("KPriorityQueue[Benchmark]", "[.][benchmark][kernel]") {
+    constexpr size_t NUM_THREADS = 512;
+
+    std::mt19937 rng{0};
+    std::uniform_int_distribution<s32> priority_dist{HIGHEST_PRIORITY, LOWEST_PRIORITY};
+    std::uniform_int_distribution<s32> core_dist{0, static_cast<s32>(NUM_CORES) - 1};
+
+    std::vector<TestThread> threads;
+    threads.reserve(NUM_THREADS);
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back(priority_dist(rng), core_dist(rng), (1ULL << NUM_CORES) - 1);
+    }
+
+    TestQueue queue;
+    for (auto& thread : threads) {
+        queue.PushBack(&thread);
+    }
+
+    // One scheduler update: a thread changes priority, then every core looks up its top thread
+    // and idle cores look for a suggested thread.
+    size_t index = 0;
+    BENCHMARK("Scheduler update") {
+        TestThread& thread = threads[index++ % NUM_THREADS];
+        const s32 prev_priority = thread.GetPriority();
+        thread.SetPriority(priority_dist(rng));
+        queue.ChangePriority(prev_priority, false, &thread);
+
+        uintptr_t result = 0;
+        for (s32 core = 0; core < static_cast<s32>(NUM_CORES); ++core) {
+            result ^= reinterpret_cast<uintptr_t>(queue.GetScheduledFront(core));
+            result ^= reinterpret_cast<uintptr_t>(queue.GetSuggestedFront(core));
+        }
+        return result;
+    };
+
+    for (auto& thread : threads) {
+        queue.Remove(&thread);
+    }
+}
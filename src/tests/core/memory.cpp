@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <numeric>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "tests/core/memory_test_environment.h"
+
+namespace {
+
+using namespace Common::Literals;
+
+constexpr VAddr BASE = 0x10000;
+
+} // Anonymous namespace
+
+TEST_CASE("Memory[BlockAcrossPages]", "[core]") {
+    constexpr std::size_t SIZE = 4 * Core::Memory::YUZU_PAGESIZE;
+    Core::Memory::MemoryTestEnvironment env{BASE, SIZE};
+    auto& memory = env.memory;
+
+    // Unaligned blocks spanning several pages are copied whole
+    std::vector<u8> source(SIZE - 0x20);
+    std::iota(source.begin(), source.end(), u8{1});
+    REQUIRE(memory.WriteBlock(BASE + 0x10, source.data(), source.size()));
+    REQUIRE(memory.Read8(BASE + 0x10) == source.front());
+    REQUIRE(memory.Read8(BASE + 0x10 + source.size() - 1) == source.back());
+
+    std::vector<u8> result(source.size());
+    REQUIRE(memory.ReadBlock(BASE + 0x10, result.data(), result.size()));
+    REQUIRE(result == source);
+}
+
+TEST_CASE("Memory[Benchmark]", "[.][benchmark][core]") {
+    constexpr std::size_t MAX_SIZE = 16_MiB;
+    Core::Memory::MemoryTestEnvironment env{BASE, MAX_SIZE};
+    auto& memory = env.memory;
+    std::vector<u8> buffer(MAX_SIZE);
+
+    for (const std::size_t size : {4_KiB, 64_KiB, 1_MiB, 16_MiB}) {
+        BENCHMARK(fmt::format("ReadBlock {} KiB", size / 1_KiB)) {
+            return memory.ReadBlock(BASE, buffer.data(), size);
+        };
+        BENCHMARK(fmt::format("WriteBlock {} KiB", size / 1_KiB)) {
+            return memory.WriteBlock(BASE, buffer.data(), size);
+        };
+    }
+}
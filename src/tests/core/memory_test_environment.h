@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/common_types.h"
+#include "common/page_table.h"
+#include "common/virtual_buffer.h"
+#include "core/core.h"
+#include "core/memory.h"
+
+namespace Core::Memory {
+
+// Guest memory backed by host pages mapped contiguously at base, without a process
+class MemoryTestEnvironment {
+public:
+    explicit MemoryTestEnvironment(VAddr base, std::size_t size) : memory{system}, backing(size) {
+        page_table.Resize(AddressSpaceBits, YUZU_PAGEBITS);
+        for (std::size_t offset = 0; offset < size; offset += YUZU_PAGESIZE) {
+            page_table.pointers[(base + offset) >> YUZU_PAGEBITS].Store(
+                reinterpret_cast<uintptr_t>(backing.data()) - base, Common::PageType::Memory);
+        }
+        memory.SetCurrentPageTable(page_table);
+    }
+
+    static constexpr std::size_t AddressSpaceBits = 32;
+
+    Core::System system;
+    Memory memory;
+    Common::PageTable page_table;
+    Common::VirtualBuffer<u8> backing;
+};
+
+} // namespace Core::Memory
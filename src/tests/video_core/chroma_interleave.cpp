@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/host1x/chroma_interleave.h"
+
+namespace {
+std::vector<u8> MakePlane(size_t width, u32 seed) {
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<u32> dist{0, 255};
+    std::vector<u8> plane(width);
+    for (u8& value : plane) {
+        value = static_cast<u8>(dist(rng));
+    }
+    return plane;
+}
+} // Anonymous namespace
+
+TEST_CASE("InterleaveChromaRow[MatchesScalar]", "[video_core]") {
+    // Widths around the vector size exercise both the vector loop and the scalar tail
+    for (const size_t width : {0, 1, 15, 16, 17, 31, 32, 33, 960}) {
+        const auto u = MakePlane(width, 1);
+        const auto v = MakePlane(width, 2);
+        std::vector<u8> expected(width * 2);
+        std::vector<u8> result(width * 2);
+        Tegra::Host1x::InterleaveChromaRowScalar(expected.data(), u.data(), v.data(), width);
+        Tegra::Host1x::InterleaveChromaRow(result.data(), u.data(), v.data(), width);
+        REQUIRE(result == expected);
+    }
+}
+
+TEST_CASE("InterleaveChromaRow[Benchmark]", "[.][benchmark][video_core]") {
+    // One chroma row of a 1080p frame
+    constexpr size_t WIDTH = 960;
+    const auto u = MakePlane(WIDTH, 1);
+    const auto v = MakePlane(WIDTH, 2);
+    std::vector<u8> dst(WIDTH * 2);
+
+    BENCHMARK("Scalar row") {
+        Tegra::Host1x::InterleaveChromaRowScalar(dst.data(), u.data(), v.data(), WIDTH);
+        return dst[WIDTH];
+    };
+    BENCHMARK("SIMD row") {
+        Tegra::Host1x::InterleaveChromaRow(dst.data(), u.data(), v.data(), WIDTH);
+        return dst[WIDTH];
+    };
+}
@@ -218,6 +218,10 @@ struct GPU::Impl {
         system.GetPerfStats().EndGameFrame();
     }
 
+    void RendererPresentNotify(const Core::PresentTimings& timings) {
+        system.GetPerfStats().AddPresentTimings(timings);
+    }
+
     /// Performs any additional setup necessary in order to begin GPU emulation.
     /// This can be used to launch any necessary threads and register any necessary
     /// core timing events.
@@ -536,6 +540,10 @@ void GPU::RendererFrameEndNotify() {
     impl->RendererFrameEndNotify();
 }
 
+void GPU::RendererPresentNotify(const Core::PresentTimings& timings) {
+    impl->RendererPresentNotify(timings);
+}
+
 void GPU::Start() {
     impl->Start();
 }
@@ -14,6 +14,7 @@
 
 namespace Core {
 class System;
+struct PresentTimings;
 } // namespace Core
 
 namespace VideoCore {
@@ -212,6 +213,9 @@ public:
 
     void RendererFrameEndNotify();
 
+    /// Notifies the performance statistics of the timings of a presented frame.
+    void RendererPresentNotify(const Core::PresentTimings& timings);
+
     void RequestComposite(std::vector<Tegra::FramebufferConfig>&& layers,
                           std::vector<Service::Nvidia::NvFence>&& fences);
 
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <emmintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#include "common/common_types.h"
+
+namespace Tegra::Host1x {
+
+/// Interleaves a row of the planar U and V planes into the NV12 chroma layout, one byte at a time
+inline void InterleaveChromaRowScalar(u8* dst, const u8* src_u, const u8* src_v, size_t width) {
+    for (size_t x = 0; x < width; ++x) {
+        dst[x * 2] = src_u[x];
+        dst[x * 2 + 1] = src_v[x];
+    }
+}
+
+/// Interleaves a row of the planar U and V planes into the NV12 chroma layout
+inline void InterleaveChromaRow(u8* dst, const u8* src_u, const u8* src_v, size_t width) {
+    size_t x = 0;
+#if defined(ARCHITECTURE_x86_64)
+    for (; x + 16 <= width; x += 16) {
+        const __m128i u = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_u + x));
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_v + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2), _mm_unpacklo_epi8(u, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2 + 16), _mm_unpackhi_epi8(u, v));
+    }
+#elif defined(ARCHITECTURE_arm64)
+    for (; x + 16 <= width; x += 16) {
+        const uint8x16x2_t uv{vld1q_u8(src_u + x), vld1q_u8(src_v + x)};
+        vst2q_u8(dst + x * 2, uv);
+    }
+#endif
+    InterleaveChromaRowScalar(dst + x * 2, src_u + x, src_v + x, width - x);
+}
+
+} // namespace Tegra::Host1x
@@ -1,7 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/assert.h"
+#include "common/microprofile.h"
 #include "common/settings.h"
 #include "video_core/host1x/codecs/codec.h"
 #include "video_core/host1x/codecs/h264.h"
@@ -10,12 +13,23 @@
 #include "video_core/host1x/host1x.h"
 #include "video_core/memory_manager.h"
 
+MICROPROFILE_DEFINE(GPU_NvdecDecode, "GPU", "Nvdec decode", MP_RGB(128, 192, 128));
+
 namespace Tegra {
 
+namespace {
+// Maximum number of packets queued on the decode thread before the submitter blocks
+constexpr size_t MaxPendingPackets = 4;
+// Maximum number of decoded frames kept before the oldest ones are dropped
+constexpr size_t MaxDecodedFrames = 10;
+// Number of decoded frames between decode statistics reports
+constexpr size_t StatsReportInterval = 300;
+} // Anonymous namespace
+
 Codec::Codec(Host1x::Host1x& host1x_, const Host1x::NvdecCommon::NvdecRegisters& regs)
     : host1x(host1x_), state{regs}, h264_decoder(std::make_unique<Decoder::H264>(host1x)),
       vp8_decoder(std::make_unique<Decoder::VP8>(host1x)),
-      vp9_decoder(std::make_unique<Decoder::VP9>(host1x)) {}
+      vp9_decoder(std::make_unique<Decoder::VP9>(host1x)), decode_worker{1, "NvdecDecoder"} {}
 
 Codec::~Codec() = default;
 
@@ -59,26 +73,69 @@ void Codec::Decode() {
         }
     }();
 
-    // Send assembled bitstream to decoder.
-    if (!decode_api.SendPacket(packet_data, configuration_size)) {
-        return;
+    // The bitstream references guest memory and decoder state that change with the next frame,
+    // copy it so the decode thread can work on it while the guest keeps submitting.
+    const bool is_visible = !vp9_hidden_frame;
+    {
+        std::unique_lock lock{frames_mutex};
+        frames_cv.wait(lock, [this] { return pending_packets < MaxPendingPackets; });
+        ++pending_packets;
+        if (is_visible) {
+            ++pending_visible_frames;
+        }
+        stats_max_queue_depth = std::max(stats_max_queue_depth, pending_packets);
     }
+    // current_codec may change before the decode thread runs, pass its name along
+    decode_worker.QueueWork([this, packet = std::vector<u8>(packet_data.begin(), packet_data.end()),
+                             configuration_size, is_visible, queue_time = Clock::now(),
+                             codec_name = GetCurrentCodecName()] {
+        DecodePacket(packet, configuration_size, is_visible, queue_time, codec_name);
+    });
+}
 
-    // Only receive/store visible frames.
-    if (vp9_hidden_frame) {
-        return;
-    }
+void Codec::DecodePacket(std::span<const u8> packet_data, size_t configuration_size,
+                         bool is_visible, Clock::time_point queue_time,
+                         std::string_view codec_name) {
+    MICROPROFILE_SCOPE(GPU_NvdecDecode);
 
-    // Receive output frames from decoder.
-    decode_api.ReceiveFrames(frames);
+    // Send assembled bitstream to decoder, only receive/store visible frames.
+    std::queue<std::unique_ptr<FFmpeg::Frame>> decoded_frames;
+    if (decode_api.SendPacket(packet_data, configuration_size) && is_visible) {
+        decode_api.ReceiveFrames(decoded_frames);
+    }
 
-    while (frames.size() > 10) {
+    std::scoped_lock lock{frames_mutex};
+    while (!decoded_frames.empty()) {
+        frames.push(std::move(decoded_frames.front()));
+        decoded_frames.pop();
+    }
+    while (frames.size() > MaxDecodedFrames) {
         LOG_DEBUG(HW_GPU, "ReceiveFrames overflow, dropped frame");
         frames.pop();
     }
+    --pending_packets;
+    if (is_visible) {
+        --pending_visible_frames;
+
+        stats_latency += Clock::now() - queue_time;
+        if (++stats_frames == StatsReportInterval) {
+            const auto average_latency =
+                std::chrono::duration_cast<std::chrono::microseconds>(stats_latency) /
+                stats_frames;
+            LOG_DEBUG(HW_GPU, "{} decode: average latency {} us, max queue depth {}", codec_name,
+                      average_latency.count(), stats_max_queue_depth);
+            stats_frames = 0;
+            stats_max_queue_depth = 0;
+            stats_latency = Clock::duration::zero();
+        }
+    }
+    frames_cv.notify_all();
 }
 
 std::unique_ptr<FFmpeg::Frame> Codec::GetCurrentFrame() {
+    std::unique_lock lock{frames_mutex};
+    frames_cv.wait(lock, [this] { return !frames.empty() || pending_visible_frames == 0; });
+
     // Sometimes VIC will request more frames than have been decoded.
     // in this case, return a blank frame and don't overwrite previous data.
     if (frames.empty()) {
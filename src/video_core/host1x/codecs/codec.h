@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string_view>
 #include <queue>
+#include <vector>
 #include "common/common_types.h"
+#include "common/thread_worker.h"
 #include "video_core/host1x/ffmpeg/ffmpeg.h"
 #include "video_core/host1x/nvdec_common.h"
 
@@ -34,10 +39,10 @@ public:
     /// Sets NVDEC video stream codec
     void SetTargetCodec(Host1x::NvdecCommon::VideoCodec codec);
 
-    /// Call decoders to construct headers, decode AVFrame with ffmpeg
+    /// Call decoders to construct headers, queue the AVFrame decode with ffmpeg
     void Decode();
 
-    /// Returns next decoded frame
+    /// Returns next decoded frame, waiting for any visible frame still being decoded
     [[nodiscard]] std::unique_ptr<FFmpeg::Frame> GetCurrentFrame();
 
     /// Returns the value of current_codec
@@ -47,6 +52,12 @@ public:
     [[nodiscard]] std::string_view GetCurrentCodecName() const;
 
 private:
+    using Clock = std::chrono::steady_clock;
+
+    /// Sends a packet to ffmpeg and receives its frames, runs on the decode thread
+    void DecodePacket(std::span<const u8> packet_data, size_t configuration_size, bool is_visible,
+                      Clock::time_point queue_time, std::string_view codec_name);
+
     bool initialized{};
     Host1x::NvdecCommon::VideoCodec current_codec{Host1x::NvdecCommon::VideoCodec::None};
     FFmpeg::DecodeApi decode_api;
@@ -57,7 +68,19 @@ private:
     std::unique_ptr<Decoder::VP8> vp8_decoder;
     std::unique_ptr<Decoder::VP9> vp9_decoder;
 
+    std::mutex frames_mutex;
+    std::condition_variable frames_cv;
     std::queue<std::unique_ptr<FFmpeg::Frame>> frames{};
+    size_t pending_packets{};
+    size_t pending_visible_frames{};
+
+    // Decode statistics
+    size_t stats_frames{};
+    size_t stats_max_queue_depth{};
+    Clock::duration stats_latency{};
+
+    // Must be the last member, so it is destroyed before the state used by queued decodes
+    Common::ThreadWorker decode_worker;
 };
 
 } // namespace Tegra
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 
 extern "C" {
@@ -14,17 +15,24 @@ extern "C" {
 #endif
 }
 
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/bit_field.h"
+#include "common/div_ceil.h"
 #include "common/logging/log.h"
+#include "common/microprofile.h"
 
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/host1x/chroma_interleave.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/host1x/nvdec.h"
 #include "video_core/host1x/vic.h"
 #include "video_core/memory_manager.h"
 #include "video_core/textures/decoders.h"
 
+MICROPROFILE_DEFINE(GPU_VicWriteRGB, "GPU", "VIC write RGB frame", MP_RGB(128, 128, 192));
+MICROPROFILE_DEFINE(GPU_VicWriteYUV, "GPU", "VIC write YUV frame", MP_RGB(128, 128, 192));
+
 namespace Tegra {
 
 namespace Host1x {
@@ -36,6 +44,11 @@ enum class VideoPixelFormat : u64_le {
     RGBX8 = 0x23,
     YUV420 = 0x44,
 };
+
+// Number of threads converting bands of rows of a frame in parallel
+constexpr size_t NUM_CONVERSION_THREADS = 4;
+// Height of a GOB, bands written to block linear surfaces must be aligned to it
+constexpr size_t GOB_HEIGHT = 8;
 } // Anonymous namespace
 
 union VicConfig {
@@ -50,10 +63,13 @@ union VicConfig {
 };
 
 Vic::Vic(Host1x& host1x_, std::shared_ptr<Nvdec> nvdec_processor_)
-    : host1x(host1x_),
-      nvdec_processor(std::move(nvdec_processor_)), converted_frame_buffer{nullptr, av_free} {}
+    : host1x(host1x_), nvdec_processor(std::move(nvdec_processor_)),
+      converted_frame_buffer{nullptr, av_free},
+      conversion_workers{NUM_CONVERSION_THREADS, "VicConversion"} {}
 
-Vic::~Vic() = default;
+Vic::~Vic() {
+    sws_freeContext(scaler_ctx);
+}
 
 void Vic::ProcessMethod(Method method, u32 argument) {
     LOG_DEBUG(HW_GPU, "Vic method 0x{:X}", static_cast<u32>(method));
@@ -109,7 +125,19 @@ void Vic::Execute() {
     }
 }
 
+template <typename Func>
+void Vic::ForEachRowBand(size_t num_rows, size_t row_alignment, Func&& func) {
+    const size_t band_rows = Common::AlignUp(
+        Common::DivCeil(num_rows, NUM_CONVERSION_THREADS), std::max<size_t>(row_alignment, 1));
+    for (size_t first_row = 0; first_row < num_rows; first_row += band_rows) {
+        const size_t rows = std::min(band_rows, num_rows - first_row);
+        conversion_workers.QueueWork([&func, first_row, rows] { func(first_row, rows); });
+    }
+    conversion_workers.WaitForRequests();
+}
+
 void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config) {
+    MICROPROFILE_SCOPE(GPU_VicWriteRGB);
     LOG_TRACE(Service_NVDRV, "Writing RGB Frame");
 
     const auto frame_width = frame->GetWidth();
@@ -158,9 +186,14 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         const u32 block_height = static_cast<u32>(config.block_linear_height_log2);
         const auto size = Texture::CalculateSize(true, 4, width, height, 1, block_height, 0);
         luma_buffer.resize_destructive(size);
-        std::span<const u8> frame_buff(converted_frame_buf_addr, 4 * width * height);
-        Texture::SwizzleSubrect(luma_buffer, frame_buff, 4, width, height, 1, 0, 0, width, height,
-                                block_height, 0, width * 4);
+        // Bands of whole GOB rows write to disjoint parts of the block linear surface
+        ForEachRowBand(height, GOB_HEIGHT, [&](size_t first_row, size_t rows) {
+            const std::span<const u8> frame_buff(converted_frame_buf_addr + first_row * width * 4,
+                                                 rows * width * 4);
+            Texture::SwizzleSubrect(luma_buffer, frame_buff, 4, width, height, 1, 0,
+                                    static_cast<u32>(first_row), width, static_cast<u32>(rows),
+                                    block_height, 0, width * 4);
+        });
 
         host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), size);
     } else {
@@ -172,6 +205,7 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
 }
 
 void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config) {
+    MICROPROFILE_SCOPE(GPU_VicWriteYUV);
     LOG_TRACE(Service_NVDRV, "Writing YUV420 Frame");
 
     const std::size_t surface_width = config.surface_width_minus1 + 1;
@@ -186,52 +220,57 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
     luma_buffer.resize_destructive(aligned_width * surface_height);
     chroma_buffer.resize_destructive(aligned_width * surface_height / 2);
 
-    // Populate luma buffer
-    const u8* luma_src = frame->GetData(0);
-    for (std::size_t y = 0; y < frame_height; ++y) {
-        const std::size_t src = y * stride;
-        const std::size_t dst = y * aligned_width;
-        std::memcpy(luma_buffer.data() + dst, luma_src + src, frame_width);
-    }
-    host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), luma_buffer.size());
-
     // Chroma
     const std::size_t half_height = frame_height / 2;
     const auto half_stride = static_cast<size_t>(frame->GetStride(1));
+    const auto pixel_format = frame->GetPixelFormat();
+    ASSERT_MSG(pixel_format == AV_PIX_FMT_YUV420P || pixel_format == AV_PIX_FMT_NV12,
+               "Unknown frame pixel format {}", static_cast<int>(pixel_format));
 
-    switch (frame->GetPixelFormat()) {
-    case AV_PIX_FMT_YUV420P: {
-        // Frame from FFmpeg software
-        // Populate chroma buffer from both channels with interleaving.
-        const std::size_t half_width = frame_width / 2;
-        u8* chroma_buffer_data = chroma_buffer.data();
-        const u8* chroma_b_src = frame->GetData(1);
-        const u8* chroma_r_src = frame->GetData(2);
-        for (std::size_t y = 0; y < half_height; ++y) {
-            const std::size_t src = y * half_stride;
+    // Each band converts its luma rows and the chroma rows shared by them
+    const u8* luma_src = frame->GetData(0);
+    ForEachRowBand(frame_height, 2, [&](size_t first_row, size_t rows) {
+        // Populate luma buffer
+        for (std::size_t y = first_row; y < first_row + rows; ++y) {
+            const std::size_t src = y * stride;
             const std::size_t dst = y * aligned_width;
-            for (std::size_t x = 0; x < half_width; ++x) {
-                chroma_buffer_data[dst + x * 2] = chroma_b_src[src + x];
-                chroma_buffer_data[dst + x * 2 + 1] = chroma_r_src[src + x];
+            std::memcpy(luma_buffer.data() + dst, luma_src + src, frame_width);
+        }
+
+        const std::size_t first_half_row = first_row / 2;
+        const std::size_t end_half_row = std::min(half_height, (first_row + rows) / 2);
+        switch (pixel_format) {
+        case AV_PIX_FMT_YUV420P: {
+            // Frame from FFmpeg software
+            // Populate chroma buffer from both channels with interleaving.
+            const std::size_t half_width = frame_width / 2;
+            const u8* chroma_b_src = frame->GetData(1);
+            const u8* chroma_r_src = frame->GetData(2);
+            for (std::size_t y = first_half_row; y < end_half_row; ++y) {
+                const std::size_t src = y * half_stride;
+                const std::size_t dst = y * aligned_width;
+                InterleaveChromaRow(chroma_buffer.data() + dst, chroma_b_src + src,
+                                    chroma_r_src + src, half_width);
             }
+            break;
         }
-        break;
-    }
-    case AV_PIX_FMT_NV12: {
-        // Frame from VA-API hardware
-        // This is already interleaved so just copy
-        const u8* chroma_src = frame->GetData(1);
-        for (std::size_t y = 0; y < half_height; ++y) {
-            const std::size_t src = y * stride;
-            const std::size_t dst = y * aligned_width;
-            std::memcpy(chroma_buffer.data() + dst, chroma_src + src, frame_width);
+        case AV_PIX_FMT_NV12: {
+            // Frame from VA-API hardware
+            // This is already interleaved so just copy
+            const u8* chroma_src = frame->GetData(1);
+            for (std::size_t y = first_half_row; y < end_half_row; ++y) {
+                const std::size_t src = y * stride;
+                const std::size_t dst = y * aligned_width;
+                std::memcpy(chroma_buffer.data() + dst, chroma_src + src, frame_width);
+            }
+            break;
         }
-        break;
-    }
-    default:
-        ASSERT(false);
-        break;
-    }
+        default:
+            // Reported by the assert above, the chroma plane is left blank
+            break;
+        }
+    });
+    host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), luma_buffer.size());
     host1x.GMMU().WriteBlock(output_surface_chroma_address, chroma_buffer.data(),
                              chroma_buffer.size());
 }
@@ -7,6 +7,7 @@
 
 #include "common/common_types.h"
 #include "common/scratch_buffer.h"
+#include "common/thread_worker.h"
 
 struct SwsContext;
 
@@ -43,6 +44,11 @@ private:
 
     void WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config);
 
+    /// Splits num_rows into bands aligned to row_alignment and runs func(first_row, num_rows)
+    /// for each of them on the conversion workers, returning once all of them finished.
+    template <typename Func>
+    void ForEachRowBand(size_t num_rows, size_t row_alignment, Func&& func);
+
     Host1x& host1x;
     std::shared_ptr<Tegra::Host1x::Nvdec> nvdec_processor;
 
@@ -60,6 +66,8 @@ private:
     SwsContext* scaler_ctx{};
     s32 scaler_width{};
     s32 scaler_height{};
+
+    Common::ThreadWorker conversion_workers;
 };
 
 } // namespace Host1x
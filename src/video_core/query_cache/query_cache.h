@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -167,6 +168,10 @@ struct QueryCacheBase<Traits>::QueryCacheBaseImpl {
     std::mutex flush_guard;
     std::deque<u64> flushes_pending;
     std::vector<QueryCacheBase<Traits>::QueryLocation> pending_unregister;
+
+    // Statistics
+    u32 frame_resolve_batches{};
+    std::atomic<u32> frame_guest_host_syncs{};
 };
 
 template <typename Traits>
@@ -363,6 +368,19 @@ void QueryCacheBase<Traits>::NotifyWFI() {
     impl->runtime.Barriers(true);
     impl->ForEachStreamer([](StreamerInterface* streamer) { streamer->SyncWrites(); });
     impl->runtime.Barriers(false);
+    ++impl->frame_resolve_batches;
+}
+
+template <typename Traits>
+void QueryCacheBase<Traits>::TickFrame() {
+    const u32 guest_host_syncs =
+        impl->frame_guest_host_syncs.exchange(0, std::memory_order_relaxed);
+    const u32 gpu_predicates = impl->runtime.GetAndResetGpuPredicates();
+    if (guest_host_syncs != 0) {
+        LOG_DEBUG(HW_GPU, "Queries forced {} host syncs this frame ({} resolves, {} predicates)",
+                  guest_host_syncs, impl->frame_resolve_batches, gpu_predicates);
+    }
+    impl->frame_resolve_batches = 0;
 }
 
 template <typename Traits>
@@ -575,6 +593,7 @@ bool QueryCacheBase<Traits>::SemiFlushQueryDirty(QueryCacheBase<Traits>::QueryLo
 
 template <typename Traits>
 void QueryCacheBase<Traits>::RequestGuestHostSync() {
+    impl->frame_guest_host_syncs.fetch_add(1, std::memory_order_relaxed);
     impl->rasterizer.ReleaseFences();
 }
 
@@ -114,6 +114,9 @@ public:
 
     void BindToChannel(s32 id) override;
 
+    /// Closes the statistics of the current frame and reports the query flushes it caused
+    void TickFrame();
+
 protected:
     template <bool remove_from_cache, typename Func>
     void IterateCache(VAddr addr, std::size_t size, Func&& func) {
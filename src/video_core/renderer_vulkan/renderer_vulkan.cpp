@@ -124,6 +124,8 @@ RendererVulkan::RendererVulkan(Core::TelemetrySession& telemetry_session_,
       rasterizer(render_window, gpu, device_memory, device, memory_allocator, state_tracker,
                  scheduler),
       applet_frame() {
+    present_manager.RegisterOnPresent(
+        [this](const Core::PresentTimings& timings) { gpu.RendererPresentNotify(timings); });
     if (Settings::values.renderer_force_max_clock.GetValue() && device.ShouldBoostClocks()) {
         turbo_mode.emplace(instance, dld);
         scheduler.RegisterOnSubmit([this] { turbo_mode->QueueSubmitted(); });
@@ -55,6 +55,10 @@ using VideoCommon::GraphicsEnvironment;
 
 constexpr u32 CACHE_VERSION = 11;
 constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'h'};
+constexpr std::array<char, 8> OBJECT_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'o', 'b'};
+
+static_assert(std::is_trivially_copyable_v<RenderPassKey>);
+static_assert(std::is_trivially_copyable_v<Tegra::Texture::TSCEntry>);
 
 template <typename Container>
 auto MakeSpan(Container& container) {
@@ -416,6 +420,9 @@ PipelineCache::~PipelineCache() {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
     }
+    if (!object_cache_filename.empty()) {
+        SerializeObjectCache(object_cache_filename, CACHE_VERSION);
+    }
 }
 
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipeline() {
@@ -478,6 +485,10 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
             LoadVulkanPipelineCache(vulkan_pipeline_cache_filename, CACHE_VERSION);
     }
 
+    // Render passes and samplers are created on the workers along with the pipelines
+    object_cache_filename = base_dir / "vulkan_objects.bin";
+    LoadObjectCache(object_cache_filename, CACHE_VERSION);
+
     struct {
         std::mutex mutex;
         size_t total{};
@@ -879,4 +890,103 @@ vk::PipelineCache PipelineCache::LoadVulkanPipelineCache(const std::filesystem::
     }
 }
 
+void PipelineCache::SerializeObjectCache(const std::filesystem::path& filename,
+                                         u32 cache_version) try {
+    render_pass_cache.ReportStatistics();
+    std::vector<Tegra::Texture::TSCEntry> sampler_descriptors;
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.ReportSamplerStatistics();
+        sampler_descriptors = texture_cache.GetSamplerDescriptors();
+    }
+    const std::vector<RenderPassKey> render_pass_keys = render_pass_cache.GetKeys();
+    const u32 num_render_passes = static_cast<u32>(render_pass_keys.size());
+    const u32 num_samplers = static_cast<u32>(sampler_descriptors.size());
+
+    std::ofstream file(filename, std::ios::binary);
+    file.exceptions(std::ifstream::failbit);
+    if (!file.is_open()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open Vulkan object cache file {}",
+                  Common::FS::PathToUTF8String(filename));
+        return;
+    }
+    file.write(OBJECT_CACHE_MAGIC_NUMBER.data(), OBJECT_CACHE_MAGIC_NUMBER.size())
+        .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version))
+        .write(reinterpret_cast<const char*>(&num_render_passes), sizeof(num_render_passes))
+        .write(reinterpret_cast<const char*>(render_pass_keys.data()),
+               render_pass_keys.size() * sizeof(RenderPassKey))
+        .write(reinterpret_cast<const char*>(&num_samplers), sizeof(num_samplers))
+        .write(reinterpret_cast<const char*>(sampler_descriptors.data()),
+               sampler_descriptors.size() * sizeof(Tegra::Texture::TSCEntry));
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    if (!Common::FS::RemoveFile(filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete Vulkan object cache file {}",
+                  Common::FS::PathToUTF8String(filename));
+    }
+}
+
+void PipelineCache::LoadObjectCache(const std::filesystem::path& filename,
+                                    u32 expected_cache_version) try {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return;
+    }
+    file.exceptions(std::ifstream::failbit);
+    const auto end{file.tellg()};
+    file.seekg(0, std::ios::beg);
+
+    // Counts come from the file, reject the ones that do not fit in it before allocating
+    const auto check_remaining = [&](u64 num_bytes) {
+        if (num_bytes > static_cast<u64>(end - file.tellg())) {
+            throw std::ios_base::failure("Truncated Vulkan object cache file");
+        }
+    };
+
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    if (magic_number != OBJECT_CACHE_MAGIC_NUMBER || cache_version != expected_cache_version) {
+        file.close();
+        if (!Common::FS::RemoveFile(filename)) {
+            LOG_ERROR(Common_Filesystem, "Failed to delete outdated Vulkan object cache file {}",
+                      Common::FS::PathToUTF8String(filename));
+        }
+        return;
+    }
+    u32 num_render_passes;
+    file.read(reinterpret_cast<char*>(&num_render_passes), sizeof(num_render_passes));
+    check_remaining(u64{num_render_passes} * sizeof(RenderPassKey));
+    std::vector<RenderPassKey> render_pass_keys(num_render_passes);
+    file.read(reinterpret_cast<char*>(render_pass_keys.data()),
+              render_pass_keys.size() * sizeof(RenderPassKey));
+
+    u32 num_samplers;
+    file.read(reinterpret_cast<char*>(&num_samplers), sizeof(num_samplers));
+    check_remaining(u64{num_samplers} * sizeof(Tegra::Texture::TSCEntry));
+    std::vector<Tegra::Texture::TSCEntry> sampler_descriptors(num_samplers);
+    file.read(reinterpret_cast<char*>(sampler_descriptors.data()),
+              sampler_descriptors.size() * sizeof(Tegra::Texture::TSCEntry));
+
+    LOG_INFO(Render_Vulkan, "Preloading {} render passes and {} samplers", num_render_passes,
+             num_samplers);
+
+    for (const RenderPassKey& key : render_pass_keys) {
+        workers.QueueWork([this, key] { render_pass_cache.Preload(key); });
+    }
+    workers.QueueWork([this, descriptors = std::move(sampler_descriptors)] {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.PreloadSamplers(descriptors);
+    });
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "{}", e.what());
+    if (!Common::FS::RemoveFile(filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to delete Vulkan object cache file {}",
+                  Common::FS::PathToUTF8String(filename));
+    }
+}
+
 } // namespace Vulkan
@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <thread>
+
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "common/thread.h"
@@ -15,9 +18,12 @@ namespace Vulkan {
 
 MICROPROFILE_DEFINE(Vulkan_WaitPresent, "Vulkan", "Wait For Present", MP_RGB(128, 128, 128));
 MICROPROFILE_DEFINE(Vulkan_CopyToSwapchain, "Vulkan", "Copy to swapchain", MP_RGB(192, 255, 192));
+MICROPROFILE_DEFINE(Vulkan_LatencySleep, "Vulkan", "Low latency sleep", MP_RGB(128, 128, 192));
 
 namespace {
 
+using Clock = std::chrono::steady_clock;
+
 bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat format) {
     const VkFormatProperties props{physical_device.GetFormatProperties(format)};
     return (props.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT);
@@ -102,8 +108,12 @@ PresentManager::PresentManager(const vk::Instance& instance_,
       memory_allocator{memory_allocator_}, scheduler{scheduler_}, swapchain{swapchain_},
       surface{surface_}, blit_supported{CanBlitToSwapchain(device.GetPhysical(),
                                                            swapchain.GetImageViewFormat())},
-      use_present_thread{Settings::values.async_presentation.GetValue()} {
+      use_present_thread{Settings::values.async_presentation.GetValue()},
+      use_low_latency{Settings::values.use_low_latency_presentation.GetValue()},
+      latency_target{std::chrono::milliseconds{
+          Settings::values.present_latency_target.GetValue()}} {
     SetImageCount();
+    queue_depth = image_count;
 
     auto& dld = device.GetLogical();
     cmdpool = dld.CreateCommandPool({
@@ -140,11 +150,25 @@ PresentManager::PresentManager(const vk::Instance& instance_,
 PresentManager::~PresentManager() = default;
 
 Frame* PresentManager::GetRenderFrame() {
+    if (use_low_latency) {
+        WaitForLatencyTarget();
+    }
+
     MICROPROFILE_SCOPE(Vulkan_WaitPresent);
 
-    // Wait for free presentation frames
+    // Wait for free presentation frames, when low latency is enabled also wait until the number
+    // of frames in flight is below the current queue depth.
     std::unique_lock lock{free_mutex};
-    free_cv.wait(lock, [this] { return !free_queue.empty(); });
+    free_cv.wait(lock, [this] {
+        if (free_queue.empty()) {
+            return false;
+        }
+        if (!use_low_latency) {
+            return true;
+        }
+        std::scoped_lock latency_lock{latency_mutex};
+        return frames.size() - free_queue.size() < queue_depth;
+    });
 
     // Take the frame from the queue
     Frame* frame = free_queue.front();
@@ -158,9 +182,12 @@ Frame* PresentManager::GetRenderFrame() {
 }
 
 void PresentManager::Present(Frame* frame) {
+    frame->submit_time = Clock::now();
+
     if (!use_present_thread) {
         scheduler.WaitWorker();
         CopyToSwapchain(frame);
+        UpdateLatency(frame, std::nullopt, Clock::now());
         free_queue.push(frame);
         return;
     }
@@ -257,6 +284,11 @@ void PresentManager::WaitPresent() {
     std::scoped_lock swapchain_lock{swapchain_mutex};
 }
 
+void PresentManager::RegisterOnPresent(
+    std::function<void(const Core::PresentTimings&)>&& on_present_) {
+    on_present = std::move(on_present_);
+}
+
 void PresentManager::PresentThread(std::stop_token token) {
     Common::SetCurrentThreadName("VulkanPresent");
     while (!token.stop_requested()) {
@@ -280,6 +312,16 @@ void PresentManager::PresentThread(std::stop_token token) {
 
         CopyToSwapchain(frame);
 
+        // In low latency mode wait for the GPU to finish the frame, this measures the GPU
+        // completion time and keeps the next frame from being queued behind this one.
+        const auto present_time = Clock::now();
+        std::optional<Clock::time_point> gpu_done;
+        if (use_low_latency) {
+            void(frame->present_done.Wait());
+            gpu_done = Clock::now();
+        }
+        UpdateLatency(frame, gpu_done, present_time);
+
         // Free the frame for reuse
         std::scoped_lock fl{free_mutex};
         free_queue.push(frame);
@@ -299,6 +341,60 @@ void PresentManager::SetImageCount() {
     image_count = std::min<size_t>(swapchain.GetImageCount(), 7);
 }
 
+void PresentManager::WaitForLatencyTarget() {
+    std::chrono::nanoseconds sleep_time{};
+    {
+        std::scoped_lock lock{latency_mutex};
+        if (queue_depth > 1 || average_latency <= latency_target) {
+            return;
+        }
+        // The frame queue can not shrink any further, delay the emulation by half of the excess
+        // latency so the next frame starts closer to when the GPU can take it. Never sleep for
+        // longer than a frame to avoid starving the GPU.
+        sleep_time = std::min((average_latency - latency_target) / 2, average_frame_interval);
+    }
+    MICROPROFILE_SCOPE(Vulkan_LatencySleep);
+    std::this_thread::sleep_for(sleep_time);
+}
+
+void PresentManager::UpdateLatency(Frame* frame, std::optional<Clock::time_point> gpu_done,
+                                   Clock::time_point present) {
+    Core::PresentTimings timings{
+        .submit = frame->submit_time,
+        .gpu_done = gpu_done,
+        .present = present,
+        .queue_depth = 0,
+    };
+    {
+        std::scoped_lock lock{latency_mutex};
+
+        // Exponential moving averages, each new sample is weighted by 1/8. Without a measured GPU
+        // completion the presentation is the closest known point.
+        const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            gpu_done.value_or(present) - frame->submit_time);
+        average_latency += (latency - average_latency) / 8;
+        if (last_present_time != Clock::time_point{}) {
+            const auto interval = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                present - last_present_time);
+            average_frame_interval += (interval - average_frame_interval) / 8;
+        }
+        last_present_time = present;
+
+        // Adapt the frame queue depth, the gap between both thresholds avoids oscillating
+        if (use_low_latency) {
+            if (average_latency > latency_target && queue_depth > 1) {
+                --queue_depth;
+            } else if (average_latency < latency_target / 2 && queue_depth < frames.size()) {
+                ++queue_depth;
+            }
+        }
+        timings.queue_depth = static_cast<u32>(queue_depth);
+    }
+    if (on_present) {
+        on_present(timings);
+    }
+}
+
 void PresentManager::CopyToSwapchain(Frame* frame) {
     bool requires_recreation = false;
 
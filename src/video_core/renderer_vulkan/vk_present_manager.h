@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
+#include <optional>
 #include <queue>
 
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
+#include "core/perf_stats.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -31,6 +35,7 @@ struct Frame {
     vk::CommandBuffer cmdbuf;
     vk::Semaphore render_ready;
     vk::Fence present_done;
+    std::chrono::steady_clock::time_point submit_time;
 };
 
 class PresentManager {
@@ -53,6 +58,9 @@ public:
     /// Waits for the present thread to finish presenting all queued frames.
     void WaitPresent();
 
+    /// Registers a callback invoked with the timings of every presented frame
+    void RegisterOnPresent(std::function<void(const Core::PresentTimings&)>&& on_present_);
+
 private:
     void PresentThread(std::stop_token token);
 
@@ -64,6 +72,11 @@ private:
 
     void SetImageCount();
 
+    void WaitForLatencyTarget();
+
+    void UpdateLatency(Frame* frame, std::optional<std::chrono::steady_clock::time_point> gpu_done,
+                       std::chrono::steady_clock::time_point present);
+
 private:
     const vk::Instance& instance;
     Core::Frontend::EmuWindow& render_window;
@@ -85,6 +98,16 @@ private:
     bool blit_supported;
     bool use_present_thread;
     std::size_t image_count{};
+
+    // Low latency presentation
+    bool use_low_latency;
+    std::chrono::nanoseconds latency_target;
+    std::chrono::nanoseconds average_latency{};
+    std::chrono::nanoseconds average_frame_interval{};
+    std::chrono::steady_clock::time_point last_present_time{};
+    std::size_t queue_depth{};
+    std::mutex latency_mutex;
+    std::function<void(const Core::PresentTimings&)> on_present;
 };
 
 } // namespace Vulkan
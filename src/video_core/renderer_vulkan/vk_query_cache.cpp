@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <map>
@@ -110,6 +112,13 @@ struct HostSyncValues {
     static constexpr bool GeneratesBaseBuffer = false;
 };
 
+struct QueryPoolCopy {
+    VkQueryPool query_pool;
+    u32 start;
+    u32 amount;
+    VkDeviceSize offset;
+};
+
 class SamplesStreamer : public BaseStreamer {
 public:
     explicit SamplesStreamer(size_t id_, QueryCacheRuntime& runtime_,
@@ -229,37 +238,45 @@ public:
         resolve_buffers.push_back(resolve_buffer_index);
         size_t base_offset = 0;
 
+        std::vector<QueryPoolCopy> pool_copies;
         ApplyBanksWideOp<true>(pending_sync, [&](SamplesQueryBank* bank, size_t start,
                                                  size_t amount) {
             size_t bank_id = bank->GetIndex();
-            auto& resolve_buffer = buffers[resolve_buffer_index];
-            VkQueryPool query_pool = bank->GetInnerPool();
-            scheduler.RequestOutsideRenderPassOperationContext();
-            scheduler.Record([start, amount, base_offset, query_pool,
-                              buffer = *resolve_buffer](vk::CommandBuffer cmdbuf) {
-                const VkBufferMemoryBarrier copy_query_pool_barrier{
-                    .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
-                    .pNext = nullptr,
-                    .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
-                    .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
-                    .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                    .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                    .buffer = buffer,
-                    .offset = base_offset,
-                    .size = amount * SamplesQueryBank::QUERY_SIZE,
-                };
-
-                cmdbuf.CopyQueryPoolResults(
-                    query_pool, static_cast<u32>(start), static_cast<u32>(amount), buffer,
-                    static_cast<u32>(base_offset), SamplesQueryBank::QUERY_SIZE,
-                    VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_64_BIT);
-                cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, copy_query_pool_barrier);
+            pool_copies.push_back(QueryPoolCopy{
+                .query_pool = bank->GetInnerPool(),
+                .start = static_cast<u32>(start),
+                .amount = static_cast<u32>(amount),
+                .offset = base_offset,
             });
             offsets[bank_id] = {start, base_offset};
             base_offset += amount * SamplesQueryBank::QUERY_SIZE;
         });
 
+        // Resolve every bank touched since the last sync into the same buffer with a single
+        // recorded operation and barrier.
+        scheduler.RequestOutsideRenderPassOperationContext();
+        scheduler.Record([copies = std::move(pool_copies), resolve_size = base_offset,
+                          buffer = *buffers[resolve_buffer_index]](vk::CommandBuffer cmdbuf) {
+            for (const QueryPoolCopy& copy : copies) {
+                cmdbuf.CopyQueryPoolResults(copy.query_pool, copy.start, copy.amount, buffer,
+                                            copy.offset, SamplesQueryBank::QUERY_SIZE,
+                                            VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_64_BIT);
+            }
+            const VkBufferMemoryBarrier copy_query_pool_barrier{
+                .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .buffer = buffer,
+                .offset = 0,
+                .size = resolve_size,
+            };
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                   0, copy_query_pool_barrier);
+        });
+
         // Convert queries
         bool has_multi_queries = false;
         for (auto q : pending_sync) {
@@ -1227,6 +1244,7 @@ struct QueryCacheRuntimeImpl {
     size_t hcr_offset;
     bool hcr_is_set;
     bool is_hcr_running;
+    u32 gpu_predicates{};
 
     // maxwell3d
     Maxwell3D* maxwell3d;
@@ -1338,11 +1356,40 @@ void QueryCacheRuntime::HostConditionalRenderingCompareBCImpl(DAddr address, boo
     ResumeHostConditionalRendering();
 }
 
+void QueryCacheRuntime::ResolvePendingQueries() {
+    // The predicate only has to be visible to the GPU, resolve the pending queries into guest
+    // memory on the GPU timeline instead of waiting for them on the host.
+    const std::array<VideoCommon::StreamerInterface*, 5> streamers{
+        &impl->guest_streamer, &impl->sample_streamer, &impl->tfb_streamer,
+        &impl->primitives_succeeded_streamer, &impl->primitives_needed_minus_succeeded_streamer};
+    // Called right before recording each predicate that reads a pending query
+    ++impl->gpu_predicates;
+    const auto has_pending_sync = [](auto* streamer) { return streamer->HasPendingSync(); };
+    if (std::ranges::none_of(streamers, has_pending_sync)) {
+        return;
+    }
+    for (auto* streamer : streamers) {
+        streamer->PresyncWrites();
+    }
+    Barriers(true);
+    for (auto* streamer : streamers) {
+        streamer->SyncWrites();
+    }
+    Barriers(false);
+}
+
+u32 QueryCacheRuntime::GetAndResetGpuPredicates() {
+    return std::exchange(impl->gpu_predicates, 0);
+}
+
 bool QueryCacheRuntime::HostConditionalRenderingCompareValue(VideoCommon::LookupData object_1,
-                                                             [[maybe_unused]] bool qc_dirty) {
+                                                             bool qc_dirty) {
     if (!impl->device.IsExtConditionalRendering()) {
         return false;
     }
+    if (qc_dirty) {
+        ResolvePendingQueries();
+    }
     HostConditionalRenderingCompareValueImpl(object_1, false);
     return true;
 }
@@ -1407,6 +1454,9 @@ bool QueryCacheRuntime::HostConditionalRenderingCompareValues(VideoCommon::Looku
     for (size_t i = 0; i < 2; i++) {
         if (is_null[i]) {
             size_t j = (i + 1) % 2;
+            if (qc_dirty) {
+                ResolvePendingQueries();
+            }
             HostConditionalRenderingCompareValueImpl(*objects[j], equal_check);
             return true;
         }
@@ -1416,9 +1466,10 @@ bool QueryCacheRuntime::HostConditionalRenderingCompareValues(VideoCommon::Looku
         return true;
     }
 
-    if (!is_in_bc[0] && !is_in_bc[1]) {
-        // Both queries are in query cache, it's best to just flush.
-        return true;
+    // Queries living in the query cache are resolved into guest memory on the GPU timeline, so
+    // both cases can be predicated without a host wait.
+    if (qc_dirty) {
+        ResolvePendingQueries();
     }
     HostConditionalRenderingCompareBCImpl(object_1.address, equal_check);
     return true;
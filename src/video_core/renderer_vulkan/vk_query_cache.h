@@ -54,6 +54,9 @@ public:
 
     VideoCommon::StreamerInterface* GetStreamerInterface(VideoCommon::QueryType query_type);
 
+    /// Returns the number of predicates read from pending queries on the GPU since the last call
+    u32 GetAndResetGpuPredicates();
+
     void Bind3DEngine(Tegra::Engines::Maxwell3D* maxwell3d);
 
     template <typename Func>
@@ -62,6 +65,7 @@ public:
 private:
     void HostConditionalRenderingCompareValueImpl(VideoCommon::LookupData object, bool is_equal);
     void HostConditionalRenderingCompareBCImpl(DAddr address, bool is_equal);
+    void ResolvePendingQueries();
     friend struct QueryCacheRuntimeImpl;
     std::unique_ptr<QueryCacheRuntimeImpl> impl;
 };
@@ -5,6 +5,7 @@
 
 #include <boost/container/static_vector.hpp>
 
+#include "common/logging/log.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/vk_render_pass_cache.h"
 #include "video_core/surface.h"
@@ -37,9 +38,56 @@ RenderPassCache::RenderPassCache(const Device& device_) : device{&device_} {}
 VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
     std::scoped_lock lock{mutex};
     const auto [pair, is_new] = cache.try_emplace(key);
+    Entry& entry = pair->second;
     if (!is_new) {
-        return *pair->second;
+        if (entry.preloaded && !entry.used) {
+            ++num_preloaded_hits;
+        }
+        entry.used = true;
+        return *entry.render_pass;
+    }
+    ++num_misses;
+    entry.render_pass = CreateRenderPass(key);
+    entry.used = true;
+    return *entry.render_pass;
+}
+
+void RenderPassCache::Preload(const RenderPassKey& key) {
+    {
+        std::scoped_lock lock{mutex};
+        if (cache.contains(key)) {
+            return;
+        }
+    }
+    // Create the render pass without holding the lock so multiple keys can be built in parallel
+    vk::RenderPass render_pass = CreateRenderPass(key);
+
+    std::scoped_lock lock{mutex};
+    const auto [pair, is_new] = cache.try_emplace(key);
+    if (is_new) {
+        pair->second.render_pass = std::move(render_pass);
+        pair->second.preloaded = true;
+        ++num_preloaded;
     }
+}
+
+std::vector<RenderPassKey> RenderPassCache::GetKeys() {
+    std::scoped_lock lock{mutex};
+    std::vector<RenderPassKey> keys;
+    keys.reserve(cache.size());
+    for (const auto& [key, entry] : cache) {
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+void RenderPassCache::ReportStatistics() {
+    std::scoped_lock lock{mutex};
+    LOG_INFO(Render_Vulkan, "Render passes: {} preloaded, {} of them used, {} created on first use",
+             num_preloaded, num_preloaded_hits, num_misses);
+}
+
+vk::RenderPass RenderPassCache::CreateRenderPass(const RenderPassKey& key) const {
     boost::container::static_vector<VkAttachmentDescription, 9> descriptions;
     std::array<VkAttachmentReference, 8> references{};
     u32 num_attachments{};
@@ -78,7 +126,7 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
         .preserveAttachmentCount = 0,
         .pPreserveAttachments = nullptr,
     };
-    pair->second = device->GetLogical().CreateRenderPass({
+    return device->GetLogical().CreateRenderPass({
         .sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
@@ -89,7 +137,6 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
         .dependencyCount = 0,
         .pDependencies = nullptr,
     });
-    return *pair->second;
 }
 
 } // namespace Vulkan
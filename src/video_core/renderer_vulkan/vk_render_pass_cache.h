@@ -5,6 +5,7 @@
 
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "video_core/surface.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -45,10 +46,30 @@ public:
 
     VkRenderPass Get(const RenderPassKey& key);
 
+    /// Creates the render pass of a key ahead of its first use, safe to call from any thread
+    void Preload(const RenderPassKey& key);
+
+    /// Returns the keys of every render pass in the cache
+    [[nodiscard]] std::vector<RenderPassKey> GetKeys();
+
+    /// Logs how many preloaded render passes were used and how many were created on first use
+    void ReportStatistics();
+
 private:
+    struct Entry {
+        vk::RenderPass render_pass;
+        bool preloaded{};
+        bool used{};
+    };
+
+    [[nodiscard]] vk::RenderPass CreateRenderPass(const RenderPassKey& key) const;
+
     const Device* device{};
-    std::unordered_map<RenderPassKey, vk::RenderPass> cache;
+    std::unordered_map<RenderPassKey, Entry> cache;
     std::mutex mutex;
+    size_t num_preloaded{};
+    size_t num_preloaded_hits{};
+    size_t num_misses{};
 };
 
 } // namespace Vulkan
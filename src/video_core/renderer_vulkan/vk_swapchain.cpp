@@ -42,7 +42,7 @@ static VkPresentModeKHR ChooseSwapPresentMode(bool has_imm, bool has_mailbox,
     Settings::VSyncMode setting = [has_imm, has_mailbox]() {
         // Choose Mailbox or Immediate if unlocked and those modes are supported
         const auto mode = Settings::values.vsync_mode.GetValue();
-        if (Settings::values.use_speed_limit.GetValue()) {
+        if (Settings::IsSpeedLimitEnabled()) {
             return mode;
         }
         switch (mode) {
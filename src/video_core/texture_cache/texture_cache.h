@@ -290,6 +290,27 @@ typename P::Sampler& TextureCache<P>::GetSampler(SamplerId id) noexcept {
     return slot_samplers[id];
 }
 
+template <class P>
+void TextureCache<P>::PreloadSamplers(std::span<const TSCEntry> descriptors) {
+    for (const TSCEntry& config : descriptors) {
+        if (!sampler_descriptors.insert(config).second) {
+            continue;
+        }
+        preloaded_samplers.emplace(config, slot_samplers.insert(runtime, config));
+    }
+}
+
+template <class P>
+std::vector<TSCEntry> TextureCache<P>::GetSamplerDescriptors() const {
+    return std::vector<TSCEntry>(sampler_descriptors.begin(), sampler_descriptors.end());
+}
+
+template <class P>
+void TextureCache<P>::ReportSamplerStatistics() const {
+    LOG_INFO(HW_GPU, "Samplers: {} preloaded, {} lookups served by them, {} created on first use",
+             preloaded_samplers.size(), num_preloaded_sampler_hits, num_sampler_misses);
+}
+
 template <class P>
 void TextureCache<P>::SynchronizeGraphicsDescriptors() {
     using SamplerBinding = Tegra::Engines::Maxwell3D::Regs::SamplerBinding;
@@ -1738,7 +1759,14 @@ SamplerId TextureCache<P>::FindSampler(const TSCEntry& config) {
     }
     const auto [pair, is_new] = channel_state->samplers.try_emplace(config);
     if (is_new) {
-        pair->second = slot_samplers.insert(runtime, config);
+        if (const auto it = preloaded_samplers.find(config); it != preloaded_samplers.end()) {
+            ++num_preloaded_sampler_hits;
+            pair->second = it->second;
+        } else {
+            ++num_sampler_misses;
+            sampler_descriptors.insert(config);
+            pair->second = slot_samplers.insert(runtime, config);
+        }
     }
     return pair->second;
 }
@@ -174,6 +174,15 @@ public:
     /// Return a reference to the given sampler id
     [[nodiscard]] Sampler& GetSampler(SamplerId id) noexcept;
 
+    /// Create samplers for the given guest descriptors ahead of their first use
+    void PreloadSamplers(std::span<const TSCEntry> descriptors);
+
+    /// Return the guest descriptors of every sampler created so far
+    [[nodiscard]] std::vector<TSCEntry> GetSamplerDescriptors() const;
+
+    /// Log how many preloaded samplers were used and how many were created on first use
+    void ReportSamplerStatistics() const;
+
     /// Refresh the state for graphics image view and sampler descriptors
     void SynchronizeGraphicsDescriptors();
 
@@ -459,6 +468,10 @@ private:
     Common::SlotVector<ImageView> slot_image_views;
     Common::SlotVector<ImageAlloc> slot_image_allocs;
     Common::SlotVector<Sampler> slot_samplers;
+    std::unordered_map<TSCEntry, SamplerId> preloaded_samplers;
+    std::unordered_set<TSCEntry> sampler_descriptors;
+    size_t num_preloaded_sampler_hits = 0;
+    size_t num_sampler_misses = 0;
     Common::SlotVector<Framebuffer> slot_framebuffers;
     Common::SlotVector<BufferDownload> slot_buffer_downloads;
 
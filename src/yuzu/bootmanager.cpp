@@ -323,9 +323,13 @@ GRenderWindow::~GRenderWindow() {
 }
 
 void GRenderWindow::OnFrameDisplayed() {
-    input_subsystem->GetTas()->UpdateThread();
-    const InputCommon::TasInput::TasState new_tas_state =
-        std::get<0>(input_subsystem->GetTas()->GetStatus());
+    auto* const tas = input_subsystem->GetTas();
+    if (!Settings::values.deterministic_replay) {
+        tas->UpdateThread();
+    } else if (tas->UpdateReplay()) {
+        Exit();
+    }
+    const InputCommon::TasInput::TasState new_tas_state = std::get<0>(tas->GetStatus());
 
     if (!first_frame) {
         last_tas_state = new_tas_state;
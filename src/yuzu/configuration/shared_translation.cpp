@@ -183,6 +183,12 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     // Renderer (Advanced Graphics)
     INSERT(Settings, async_presentation, tr("Enable asynchronous presentation (Vulkan only)"),
            tr("Slightly improves performance by moving presentation to a separate CPU thread."));
+    INSERT(Settings, use_low_latency_presentation, QStringLiteral(), QStringLiteral());
+    INSERT(Settings, present_latency_target, tr("Low latency presentation target (ms)"),
+           tr("Limits the number of frames queued for presentation and delays the emulation just "
+              "enough to keep the time between a frame being submitted and being finished by the "
+              "GPU below this target.\nLower values reduce input latency at the cost of "
+              "performance under heavy load."));
     INSERT(
         Settings, renderer_force_max_clock, tr("Force maximum clocks (Vulkan only)"),
         tr("Runs work in the background while waiting for graphics commands to keep the GPU from "
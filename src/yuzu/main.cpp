@@ -1963,6 +1963,13 @@ void GMainWindow::BootGame(const QString& filename, Service::AM::FrontendAppletP
 
     Settings::LogSettings();
 
+    if (Settings::values.deterministic_replay && !input_subsystem->GetTas()->CanStartReplay()) {
+        QMessageBox::critical(this, tr("Error while starting the replay"),
+                              tr("Replays need a TAS script that does not loop. See the log for "
+                                 "details."));
+        return;
+    }
+
     if (UISettings::values.select_user_on_boot && !user_flag_cmd_line) {
         const Core::Frontend::ProfileSelectParameters parameters{
             .mode = Service::AM::Frontend::UiMode::UserSelector,
@@ -4651,14 +4658,14 @@ void GMainWindow::UpdateStatusBar() {
     res_scale_label->setText(
         tr("Scale: %1x", "%1 is the resolution scaling factor").arg(res_scale));
 
-    if (Settings::values.use_speed_limit.GetValue()) {
+    if (Settings::IsSpeedLimitEnabled()) {
         emu_speed_label->setText(tr("Speed: %1% / %2%")
                                      .arg(results.emulation_speed * 100.0, 0, 'f', 0)
                                      .arg(Settings::values.speed_limit.GetValue()));
     } else {
         emu_speed_label->setText(tr("Speed: %1%").arg(results.emulation_speed * 100.0, 0, 'f', 0));
     }
-    if (!Settings::values.use_speed_limit) {
+    if (!Settings::IsSpeedLimitEnabled()) {
         game_fps_label->setText(
             tr("Game: %1 FPS (Unlocked)").arg(std::round(results.average_game_fps), 0, 'f', 0));
     } else {
@@ -4668,7 +4675,7 @@ void GMainWindow::UpdateStatusBar() {
     emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
 
     res_scale_label->setVisible(true);
-    emu_speed_label->setVisible(!Settings::values.use_multi_core.GetValue());
+    emu_speed_label->setVisible(!Settings::IsMultiCoreEnabled());
     game_fps_label->setVisible(true);
     emu_frametime_label->setVisible(true);
     firmware_label->setVisible(false);
@@ -11,6 +11,7 @@
 #include "hid_core/hid_core.h"
 #include "input_common/drivers/keyboard.h"
 #include "input_common/drivers/mouse.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/drivers/touch_screen.h"
 #include "input_common/main.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
@@ -232,6 +233,15 @@ void EmuWindow_SDL2::WaitEvent() {
     }
 }
 
+void EmuWindow_SDL2::OnFrameDisplayed() {
+    if (Settings::values.deterministic_replay && input_subsystem->GetTas()->UpdateReplay()) {
+        // This runs on the GPU thread, let WaitEvent close the window
+        SDL_Event quit_event{};
+        quit_event.type = SDL_QUIT;
+        SDL_PushEvent(&quit_event);
+    }
+}
+
 // Credits to Samantas5855 and others for this function.
 void EmuWindow_SDL2::SetWindowIcon() {
     SDL_RWops* const yuzu_icon_stream = SDL_RWFromConstMem((void*)yuzu_icon, yuzu_icon_size);
@@ -36,6 +36,9 @@ public:
     // Sets the window icon from yuzu.bmp
     void SetWindowIcon();
 
+    /// Plays the TAS scripts of deterministic replays and closes the window when they finish
+    void OnFrameDisplayed() override;
+
 protected:
     /// Called by WaitEvent when a key is pressed or released.
     void OnKeyEvent(int key, u8 state);
@@ -31,6 +31,7 @@
 #include "core/loader/loader.h"
 #include "core/telemetry_session.h"
 #include "frontend_common/config.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/main.h"
 #include "network/network.h"
 #include "sdl_config.h"
@@ -359,6 +360,10 @@ int main(int argc, char** argv) {
         break;
     }
 
+    if (Settings::values.deterministic_replay && !input_subsystem.GetTas()->CanStartReplay()) {
+        return -1;
+    }
+
 #ifdef _WIN32
     Common::Windows::SetCurrentTimerResolutionToMaximum();
     system.CoreTiming().SetTimerResolutionNs(Common::Windows::GetCurrentTimerResolution());
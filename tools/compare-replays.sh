@@ -0,0 +1,32 @@
+#!/bin/bash -e
+
+# SPDX-FileCopyrightText: 2024 yuzu Emulator Project
+# SPDX-License-Identifier: MIT
+
+# Runs a deterministic replay twice and checks that both runs emulated the same number of frames
+# in the same emulated time. The config must enable deterministic_replay and TAS, with the scripts
+# of the replay in the TAS directory.
+
+if [ "$#" -ne 3 ]; then
+    echo "Usage: $0 <yuzu-cmd> <config.ini> <game>" >&2
+    exit 2
+fi
+
+run_replay() {
+    "$1" -c "$2" "$3" 2>&1 | grep -o "Replay of [0-9]* frames in [0-9.]* emulated s" || true
+}
+
+first=$(run_replay "$@")
+second=$(run_replay "$@")
+
+if [ -z "$first" ] || [ -z "$second" ]; then
+    echo "A run did not finish its replay" >&2
+    exit 1
+fi
+
+echo "first run:  $first"
+echo "second run: $second"
+if [ "$first" != "$second" ]; then
+    echo "The replay is not deterministic" >&2
+    exit 1
+fi